@@ -1,4 +1,5 @@
 #include "audio.h"
+#include "profiler.h"
 
 // =============================================================================
 // Sound Effect Handles
@@ -77,13 +78,18 @@ void set_bgm_volume(float volume) {
 }
 
 // =============================================================================
-// Audio Update (call every frame)
+// Mixing
 // =============================================================================
+// mixer_poll() submits an RSP job through rspq, which is not thread-safe, so
+// mixing runs on the main thread. Called once per frame; it fills every
+// buffer the audio driver has free, so a slow frame doesn't starve it.
 
 void update_audio(void) {
-    if (audio_can_write()) {
+    PROFILE_BEGIN(PROF_AUDIO);
+    while (audio_can_write()) {
         short *buf = audio_write_begin();
         mixer_poll(buf, audio_get_buffer_length());
         audio_write_end();
     }
+    PROFILE_END(PROF_AUDIO);
 }
@@ -32,6 +32,6 @@ void play_sfx(int sfx_type);
 void play_bgm(const char *filename);
 void stop_bgm(void);
 void set_bgm_volume(float volume);
-void update_audio(void);
+void update_audio(void);        // Main thread only - mixer_poll() goes through rspq
 
 #endif // AUDIO_H
@@ -2,10 +2,12 @@
 #include "constants.h"
 #include "game_state.h"
 #include "entity.h"
+#include "entity_pool.h"
 #include "particles.h"
 #include "audio.h"
 #include "camera.h"
 #include "spawner.h"
+#include "spatial_grid.h"
 #include <math.h>
 #include <joypad.h>
 #include "utils.h"
@@ -24,28 +26,186 @@ extern bool *resource_visible;
 extern Entity *cursor_entity;
 extern T3DVec3 cursor_velocity;
 
+// =============================================================================
+// Spatial Grids (broad phase)
+// =============================================================================
+
+static SpatialGrid asteroid_grid;
+static SpatialGrid resource_grid;
+static int grid_candidates[SPATIAL_GRID_MAX_ITEMS];
+
+void build_collision_grids(const AsteroidStore *asteroids, Entity *resources, int resource_count) {
+    spatial_grid_clear(&asteroid_grid);
+    for (int i = 0; i < asteroids->count; i++) {
+        spatial_grid_insert(&asteroid_grid, i, asteroids->x[i], asteroids->z[i], ASTEROID_COLLISION_RADIUS);
+    }
+
+    spatial_grid_clear(&resource_grid);
+    for (int i = 0; i < resource_count; i++) {
+        spatial_grid_insert(&resource_grid, i, resources[i].position.v[0], resources[i].position.v[2],
+                            resources[i].collision_radius);
+    }
+}
+
+// Candidates near (x, z) in ascending index order, so hits are handled in the
+// same order as a linear scan. Items moved since the last build (respawns) may
+// be missed until the next tick's rebuild.
+static int query_grid(const SpatialGrid *grid, float x, float z, float radius) {
+    int count = spatial_grid_query(grid, x, z, radius, grid_candidates, SPATIAL_GRID_MAX_ITEMS);
+
+    for (int i = 1; i < count; i++) {
+        int value = grid_candidates[i];
+        int j = i - 1;
+        while (j >= 0 && grid_candidates[j] > value) {
+            grid_candidates[j + 1] = grid_candidates[j];
+            j--;
+        }
+        grid_candidates[j + 1] = value;
+    }
+    return count;
+}
+
+// =============================================================================
+// Swept Collision
+// =============================================================================
+// Asteroids can cover more than their combined radius with the ship between
+// checks, so tests sweep the relative motion since the previous check instead
+// of testing a single instant.
+
+// Time of impact (0..1) of a point moving from (x0, z0) to (x1, z1) against a
+// circle of the given radius at the origin, or -1 for a miss
+static float swept_circle_toi(float x0, float z0, float x1, float z1, float radius) {
+    float c = x0 * x0 + z0 * z0 - radius * radius;
+    if (c < 0.0f) return 0.0f;  // Already overlapping at the start
+
+    float dx = x1 - x0;
+    float dz = z1 - z0;
+    float a = dx * dx + dz * dz;
+    float half_b = x0 * dx + z0 * dz;
+    if (a < 0.0001f || half_b >= 0.0f) return -1.0f;  // Not closing in
+
+    float disc = half_b * half_b - a * c;
+    if (disc < 0.0f) return -1.0f;
+
+    float t = (-half_b - sqrtf(disc)) / a;
+    return (t <= 1.0f) ? t : -1.0f;
+}
+
+// Asteroids fly in straight lines, so where one was `elapsed` seconds ago is
+// recovered from its velocity
+static void get_asteroid_sweep_start(const AsteroidStore *asteroids, int i, float elapsed, float *out_x, float *out_z) {
+    *out_x = asteroids->x[i] - asteroids->vx[i] * elapsed;
+    *out_z = asteroids->z[i] - asteroids->vz[i] * elapsed;
+}
+
+static float get_max_asteroid_travel(float elapsed) {
+    return ASTEROID_BASE_MAX_SPEED * get_asteroid_speed_for_difficulty() * elapsed;
+}
+
+// Ship position at the previous cursor/asteroid check (start of the next sweep)
+static T3DVec3 cursor_sweep_start;
+static bool cursor_sweep_valid = false;
+
+static T3DVec3 get_cursor_sweep_start(Entity *cursor) {
+    if (!cursor_sweep_valid) return cursor->position;
+
+    float dx = cursor->position.v[0] - cursor_sweep_start.v[0];
+    float dz = cursor->position.v[2] - cursor_sweep_start.v[2];
+    if (dx * dx + dz * dz > INTERP_SNAP_DIST_SQ) {
+        return cursor->position;  // Respawned/teleported - don't sweep across the map
+    }
+    return cursor_sweep_start;
+}
+
+static void end_cursor_asteroid_sweep(Entity *cursor) {
+    cursor_sweep_start = cursor->position;
+    cursor_sweep_valid = true;
+}
+
+// Sweeps an asteroid against a target that moved from target_start to
+// target_end over the same interval. Returns TOI or -1, and the asteroid's
+// position at impact.
+static float sweep_asteroid(T3DVec3 target_start, T3DVec3 target_end, const AsteroidStore *asteroids, int i,
+                            float elapsed, float radius, T3DVec3 *out_impact) {
+    float ax0, az0;
+    get_asteroid_sweep_start(asteroids, i, elapsed, &ax0, &az0);
+    float ax1 = asteroids->x[i];
+    float az1 = asteroids->z[i];
+
+    float t = swept_circle_toi(ax0 - target_start.v[0], az0 - target_start.v[2],
+                               ax1 - target_end.v[0], az1 - target_end.v[2], radius);
+    if (t >= 0.0f) {
+        out_impact->v[0] = ax0 + (ax1 - ax0) * t;
+        out_impact->v[1] = ASTEROID_HEIGHT;
+        out_impact->v[2] = az0 + (az1 - az0) * t;
+    }
+    return t;
+}
+
+static float get_cursor_travel(T3DVec3 cursor_start, Entity *cursor) {
+    float dx = cursor->position.v[0] - cursor_start.v[0];
+    float dz = cursor->position.v[2] - cursor_start.v[2];
+    float dist_sq = dx * dx + dz * dz;
+    return (dist_sq > 0.0001f) ? dist_sq * fast_inv_sqrt(dist_sq) : 0.0f;
+}
+
 // =============================================================================
 // Color Flash System
 // =============================================================================
 
 static ColorFlash color_flashes[MAX_COLOR_FLASHES];
 
+// Flashes hold a pool handle, so one whose entity is despawned or respawned
+// simply ends instead of writing through a dangling pointer
+void start_entity_color_flash(Entity *entity, color_t flash_color, float duration_seconds) {
+    EntityHandle handle = entity_pool_handle_of(entity);
+    if (!entity_pool_get(handle)) return;
+
+    // Restart an existing flash on this entity, otherwise take a free slot
+    ColorFlash *flash = NULL;
+    for (int i = 0; i < MAX_COLOR_FLASHES && !flash; i++) {
+        if (color_flashes[i].active && color_flashes[i].entity.index == handle.index &&
+            color_flashes[i].entity.generation == handle.generation) {
+            flash = &color_flashes[i];
+        }
+    }
+    for (int i = 0; i < MAX_COLOR_FLASHES && !flash; i++) {
+        if (!color_flashes[i].active) {
+            flash = &color_flashes[i];
+            flash->original_color = entity->color;
+        }
+    }
+    if (!flash) return;
+
+    flash->entity = handle;
+    flash->flash_color = flash_color;
+    flash->timer = 0.0f;
+    flash->duration = duration_seconds;
+    flash->active = true;
+}
+
 void update_color_flashes(float delta_time) {
     for (int i = 0; i < MAX_COLOR_FLASHES; i++) {
         if (!color_flashes[i].active) continue;
 
+        Entity *entity = entity_pool_get(color_flashes[i].entity);
+        if (!entity) {
+            color_flashes[i].active = false;
+            continue;
+        }
+
         color_flashes[i].timer += delta_time;
 
         if (color_flashes[i].timer >= color_flashes[i].duration) {
-            color_flashes[i].entity->color = color_flashes[i].original_color;
+            entity->color = color_flashes[i].original_color;
             color_flashes[i].active = false;
-            color_flashes[i].entity = NULL;
+            color_flashes[i].entity = ENTITY_HANDLE_NONE;
         } else {
             int blink_state = (int)(color_flashes[i].timer * 10) % 2;
             if (blink_state == 0) {
-                color_flashes[i].entity->color = color_flashes[i].flash_color;
+                entity->color = color_flashes[i].flash_color;
             } else {
-                color_flashes[i].entity->color = color_flashes[i].original_color;
+                entity->color = color_flashes[i].original_color;
             }
         }
     }
@@ -67,24 +227,19 @@ float calculate_asteroid_damage(Entity *asteroid) {
 // =============================================================================
 
 
-void check_loader_asteroid_collisions_opt(Entity *loader, Asteroid *asteroids, int count, float delta_time) {
-    const float asteroid_collision_radius = 10.0f;
+// Hits are scheduled when each asteroid spawns (see set_asteroid_target_circle),
+// so this only handles the ones that have come due
+void check_loader_asteroid_collisions_opt(Entity *loader, AsteroidStore *asteroids) {
+    int hits[ASTEROID_EVENT_CAPACITY];
+    int hit_count = pop_asteroid_target_hits(hits, ASTEROID_EVENT_CAPACITY);
 
-    for (int i = 0; i < count; i++) {
-        // Distance-based early rejection
-        float dx = loader->position.v[0] - asteroids[i].position.v[0];
-        float dz = loader->position.v[2] - asteroids[i].position.v[2];
-        float dist_sq = dx * dx + dz * dz;
-        float max_range = loader->collision_radius + asteroid_collision_radius + 50.0f;
-        if (dist_sq > max_range * max_range) continue;
+    for (int h = 0; h < hit_count; h++) {
+        int i = hits[h];
+        if (i >= asteroids->count) continue;
 
-        // Actual collision check
-        float combined_radius = loader->collision_radius + asteroid_collision_radius;
-        if (dist_sq < combined_radius * combined_radius) {
-            spawn_explosion(asteroids[i].position, COLOR_SPARKS);
-            // play_sfx(4);
-            reset_asteroid(&asteroids[i]);
-        }
+        spawn_explosion(get_asteroid_position(asteroids, i), COLOR_SPARKS);
+        // play_sfx(4);
+        reset_asteroid(asteroids, i);
     }
 }
 
@@ -259,7 +414,8 @@ void update_deflect_timer(float delta_time) {
 static float mining_accumulated = 0.0f;
 static bool cursor_was_mining = false;
 
-static void mine_resource(Entity *entity, Entity *resource, float delta_time) {
+// Returns true if the resource was used up and respawned
+static bool mine_resource(Entity *entity, Entity *resource, float delta_time) {
     float amount = delta_time * MINING_RATE;
     mining_accumulated += amount;
 
@@ -281,66 +437,17 @@ static void mine_resource(Entity *entity, Entity *resource, float delta_time) {
         entity->value += 5; // replenish some energy on resource depletion
         queue_message("Repair +5!", 0.75f);
         reset_entity(resource, RESOURCE);
+        return true;
     }
+    return false;
 }
 
-void check_cursor_resource_collisions(Entity *cursor, Entity *resources, int count, float delta_time) {
-    game.cursor_mining_resource = -1;
-    game.cursor_is_mining = false;
-    bool found_mining = false;
-
-    for (int i = 0; i < count; i++) {
-        // Distance-based early rejection
-        float dx = cursor->position.v[0] - resources[i].position.v[0];
-        float dz = cursor->position.v[2] - resources[i].position.v[2];
-        float dist_sq = dx * dx + dz * dz;
-        float max_range = cursor->collision_radius + resources[i].collision_radius + 20.0f;
-        if (dist_sq > max_range * max_range) {
-            cursor->color = COLOR_CURSOR;
-            continue;
-        }
-
-
-        if (check_entity_intersection(cursor, &resources[i]) && (game.cursor_resource_val < CURSOR_RESOURCE_CAPACITY)) {
-            game.cursor_is_mining = true;
-
-
-            // Flicker both resource and cursor color - welder effect
-            int flicker = rand() % 100;
-            if (flicker < 10) {
-                cursor->color = RGBA32(0, 0, 0, 255);
-            } else if (flicker < 40) {
-                resources[i].color = RGBA32(255, 255, 255, 255);
-                cursor->color = RGBA32(100, 100, 100, 255);
-            } else if (flicker < 70) {
-                resources[i].color = RGBA32(200, 200, 200, 255);
-                cursor->color = RGBA32(220, 220, 220, 255);
-            } else {
-                resources[i].color = COLOR_RESOURCE;
-                cursor->color = COLOR_CURSOR;
-            }
-
-            // Only play sound when mining starts
-            if (!cursor_was_mining) {
-                play_sfx(1);
-            }
-            found_mining = true;
-            game.cursor_mining_resource = i;
-            mine_resource(cursor, &resources[i], delta_time);
-            break;
-        } else {
-            cursor->color = COLOR_CURSOR;
-        }
-    }
-
-    cursor_was_mining = found_mining;
-}
 
 // =============================================================================
 // Drone Collisions
 // =============================================================================
 
-static void drone_mine_resource(Entity *entity, Entity *resource, float delta_time) {
+static bool drone_mine_resource(Entity *entity, Entity *resource, float delta_time) {
     float amount = delta_time * DRONE_MINING_RATE;
     game.drone_mining_accumulated += amount;
 
@@ -372,53 +479,11 @@ static void drone_mine_resource(Entity *entity, Entity *resource, float delta_ti
         resource->value = 0;
         resource->color = COLOR_ASTEROID;
         reset_entity(resource, RESOURCE);
+        return true;
     }
+    return false;
 }
 
-void check_drone_resource_collisions(Entity *entity, Entity *resources, int count, float delta_time) {
-    game.drone_mining_resource = -1;
-    game.drone_collecting_resource = false;
-    game.drone_is_mining = false;
-
-    // Update drone_full based on current resource level
-    game.drone_full = (game.drone_resource_val >= DRONE_MAX_RESOURCES);
-
-    for (int i = 0; i < count; i++) {
-        // Distance-based early rejection
-        float dx = entity->position.v[0] - resources[i].position.v[0];
-        float dz = entity->position.v[2] - resources[i].position.v[2];
-        float dist_sq = dx * dx + dz * dz;
-        float max_range = entity->collision_radius + resources[i].collision_radius + 20.0f;
-        if (dist_sq > max_range * max_range) continue;
-
-        if (check_entity_intersection(entity, &resources[i]) &&
-            game.drone_resource_val < DRONE_MAX_RESOURCES) {
-            game.drone_collecting_resource = true;
-            trigger_rumble(0.01f);
-
-
-            game.drone_is_mining = true;
-            entity->position.v[1] = resources[i].position.v[1] + 5.0f;
-            entity->position.v[0] = resources[i].position.v[0];
-            entity->position.v[2] = resources[i].position.v[2];
-
-            // Flicker resource color - welder effect
-            int flicker = rand() % 100;
-            if (flicker < 40) {
-                resources[i].color = RGBA32(111, 239, 255, 255);
-            } else if (flicker < 70) {
-                resources[i].color = RGBA32(200, 200, 200, 255);
-            } else {
-                resources[i].color = COLOR_RESOURCE;
-            }
-
-            game.drone_mining_resource = i;
-            drone_mine_resource(entity, &resources[i], delta_time);
-
-            break;
-        }
-    }
-}
 
 void check_drone_station_collisions(Entity *drone, Entity *station, int count) {
     if (check_entity_intersection(drone, station)) {
@@ -465,34 +530,6 @@ void check_drone_cursor_collisions(Entity *drone, Entity *cursor, int count) {
     }
 }
 
-// =============================================================================
-// Tile Collisions
-// =============================================================================
-
-void check_tile_resource_collision(Entity *tile, Entity *resources, int count) {
-    // Only check if tile is visible and not already following something
-    if (tile->position.v[1] > 100.0f) return;
-    if (game.drone_full) return;
-
-    for (int i = 0; i < count; i++) {
-        if (check_entity_intersection(tile, &resources[i])) {
-            // Start following this resource
-            game.tile_following_resource = i;
-
-            // Send drone to this resource
-            game.drone_target_position.v[0] = resources[i].position.v[0];
-            game.drone_target_position.v[1] = resources[i].position.v[1];
-            game.drone_target_position.v[2] = resources[i].position.v[2];
-            game.drone_target_rotation = 0.0f;
-            game.move_drone = true;
-            game.drone_moving_to_resource = true;
-            game.drone_moving_to_station = false;
-
-            return;
-        }
-    }
-}
-
 // =============================================================================
 // Utility Functions
 // =============================================================================
@@ -524,97 +561,324 @@ void check_deflect_input(void) {
 }
 
 // =============================================================================
-// Optimized Asteroid Collision Functions (uses Asteroid struct)
+// Optimized Asteroid Collision Functions (uses AsteroidStore)
 // =============================================================================
 
-float calculate_asteroid_damage_opt(Asteroid *asteroid) {
-    float mass = asteroid->scale * asteroid->scale * asteroid->scale;
-    float kinetic_energy = 0.25f * mass * asteroid->speed * asteroid->speed;
+float calculate_asteroid_damage_opt(const AsteroidStore *asteroids, int i) {
+    float scale = asteroids->scale[i];
+    float speed = asteroids->speed[i];
+    float mass = scale * scale * scale;
+    float kinetic_energy = 0.25f * mass * speed * speed;
     return kinetic_energy * DAMAGE_MULTIPLIER;
 }
 
-void check_cursor_asteroid_collisions_opt(Entity *cursor, Asteroid *asteroids, int count, bool *visibility, float delta_time) {
-    if (game.deflect_active || game.cursor_is_mining) return;
-    if (game.cursor_iframe_timer > 0.0f) {
-        game.cursor_iframe_timer -= delta_time;
+// =============================================================================
+// Contact Pipeline
+// =============================================================================
+// collect_contacts() runs every probe (ship, drone, tile, deflect field)
+// against the grids once per tick and records what touched what. Handlers
+// then apply the gameplay results from that list, so sound, messages and
+// effects stay out of the search loops.
+
+static Contact contacts[CONTACT_LIST_SIZE];
+static int contact_count = 0;
+
+// Resources respawned by mining this tick - later contacts with them are stale
+static int respawned_resources[2];
+static int respawned_count = 0;
+
+static void add_contact(ContactKind kind, EntityID probe, int index, T3DVec3 point) {
+    if (contact_count >= CONTACT_LIST_SIZE) return;
+
+    Contact *contact = &contacts[contact_count++];
+    contact->kind = kind;
+    contact->a = probe;
+    contact->b = index;
+    contact->point = point;
+}
+
+static const Contact *find_contact(ContactKind kind) {
+    for (int c = 0; c < contact_count; c++) {
+        if (contacts[c].kind == kind) return &contacts[c];
     }
+    return NULL;
+}
 
-    // Asteroid collision radius (constant for all)
-    const float asteroid_collision_radius = 10.0f;
+static bool was_respawned(int index) {
+    for (int r = 0; r < respawned_count; r++) {
+        if (respawned_resources[r] == index) return true;
+    }
+    return false;
+}
 
-    for (int i = 0; i < count; i++) {
-        if (visibility && !visibility[i]) continue;
+static void mark_respawned(int index) {
+    if (respawned_count < 2) {
+        respawned_resources[respawned_count++] = index;
+    }
+}
 
-        // Distance-based early rejection
-        float dx = cursor->position.v[0] - asteroids[i].position.v[0];
-        float dz = cursor->position.v[2] - asteroids[i].position.v[2];
-        float dist_sq = dx * dx + dz * dz;
-        float max_range = cursor->collision_radius + asteroid_collision_radius + 30.0f;
-        if (dist_sq > max_range * max_range) continue;
+// A probe only ever works one resource, so only the first overlap (lowest
+// index, as a linear scan would find) is recorded
+static void collect_resource_contact(ContactKind kind, EntityID id, Entity *probe, Entity *resources, int count) {
+    if (probe->collision_radius <= 0.0f) return;
 
-        // Actual collision check
-        float combined_radius = cursor->collision_radius + asteroid_collision_radius;
-        if (dist_sq < combined_radius * combined_radius) {
-            if (game.cursor_iframe_timer <= 0.0f) {
-                queue_message("Ouch!", 0.75f);
-                play_sfx(4);
-                float damage = calculate_asteroid_damage_opt(&asteroids[i]);
-                if (damage <= MAX_DAMAGE * ship_damage_multiplier) {
-                    damage = MAX_DAMAGE * ship_damage_multiplier;
-                }
-                spawn_explosion(asteroids[i].position, COLOR_SPARKS);
-                cursor->value -= damage;
-                game.cursor_last_damage = (int)damage;
+    int candidates = query_grid(&resource_grid, probe->position.v[0], probe->position.v[2],
+                                probe->collision_radius + resource_grid.max_radius);
 
-                if (cursor->value < 0) {
-                    cursor->value = 0;
-                    game.disabled_controls = true;
-                } else if (cursor->value > 0 && game.ship_fuel > 0) {
-                    game.disabled_controls = false;
-                }
+    for (int c = 0; c < candidates; c++) {
+        int i = grid_candidates[c];
+        if (i >= count) continue;
 
-                // Add asteroid velocity to cursor velocity (knockback)
-                game.cursor_velocity.v[0] += asteroids[i].velocity.v[0] * KNOCKBACK_STRENGTH;
-                game.cursor_velocity.v[2] += asteroids[i].velocity.v[2] * KNOCKBACK_STRENGTH;
+        if (check_entity_intersection(probe, &resources[i])) {
+            add_contact(kind, id, i, resources[i].position);
+            return;
+        }
+    }
+}
 
-                other_shake_enabled = damage > 0 ? true : false;
-                if (other_shake_enabled) {
-                    trigger_screen_shake(3.0f, 0.25f);
-                }
+// Every asteroid the ship swept into since the previous check
+static void collect_asteroid_contacts(ContactKind kind, const CollisionScene *scene, T3DVec3 cursor_start,
+                                      float radius, float elapsed, bool visible_only) {
+    Entity *cursor = scene->cursor;
+    float query_radius = radius + get_max_asteroid_travel(elapsed) + get_cursor_travel(cursor_start, cursor);
+    int candidates = query_grid(&asteroid_grid, cursor->position.v[0], cursor->position.v[2], query_radius);
+
+    for (int c = 0; c < candidates; c++) {
+        int i = grid_candidates[c];
+        if (i >= scene->asteroids->count) continue;
+        if (visible_only && scene->asteroid_visible && !scene->asteroid_visible[i]) continue;
+
+        T3DVec3 impact;
+        if (sweep_asteroid(cursor_start, cursor->position, scene->asteroids, i, elapsed, radius, &impact) >= 0.0f) {
+            add_contact(kind, ENTITY_CURSOR, i, impact);
+        }
+    }
+}
 
-                // Rumble based on damage (0.1s to 0.4s based on hit strength)
-                float rumble_duration = 0.1f + (damage / (MAX_DAMAGE * ship_damage_multiplier * 2.0f)) * 0.3f;
-                if (rumble_duration > 0.4f) rumble_duration = 0.4f;
-                trigger_rumble(rumble_duration);
+int collect_contacts(const CollisionScene *scene, float asteroid_elapsed) {
+    contact_count = 0;
+    respawned_count = 0;
 
-                game.cursor_iframe_timer = CURSOR_IFRAME_DURATION;
-            }
-            reset_asteroid(&asteroids[i]);
+    collect_resource_contact(CONTACT_CURSOR_RESOURCE, ENTITY_CURSOR, scene->cursor,
+                             scene->resources, scene->resource_count);
+    collect_resource_contact(CONTACT_DRONE_RESOURCE, ENTITY_DRONE, scene->drone,
+                             scene->resources, scene->resource_count);
+
+    // Tile is parked off-field when not in use
+    if (scene->tile->position.v[1] <= 100.0f) {
+        collect_resource_contact(CONTACT_TILE_RESOURCE, ENTITY_TILE, scene->tile,
+                                 scene->resources, scene->resource_count);
+    }
+
+    if (asteroid_elapsed > 0.0f) {
+        T3DVec3 cursor_start = get_cursor_sweep_start(scene->cursor);
+        if (game.deflect_active) {
+            collect_asteroid_contacts(CONTACT_DEFLECT_ASTEROID, scene, cursor_start,
+                                      DEFLECT_RADIUS, asteroid_elapsed, false);
+        } else {
+            collect_asteroid_contacts(CONTACT_CURSOR_ASTEROID, scene, cursor_start,
+                                      scene->cursor->collision_radius + ASTEROID_COLLISION_RADIUS,
+                                      asteroid_elapsed, true);
         }
+        end_cursor_asteroid_sweep(scene->cursor);
     }
+
+    return contact_count;
 }
 
-void check_cursor_asteroid_deflection_opt(Entity *cursor, Asteroid *asteroids, int count) {
-    if (!game.deflect_active) return;
+// =============================================================================
+// Contact Handlers - Resources
+// =============================================================================
 
-    float deflect_radius_sq = DEFLECT_RADIUS * DEFLECT_RADIUS;
+static void handle_cursor_resource_contact(const CollisionScene *scene, float delta_time) {
+    Entity *cursor = scene->cursor;
+    game.cursor_mining_resource = -1;
+    game.cursor_is_mining = false;
 
-    for (int i = 0; i < count; i++) {
-        float dx = cursor->position.v[0] - asteroids[i].position.v[0];
-        float dz = cursor->position.v[2] - asteroids[i].position.v[2];
-        float dist_sq = dx * dx + dz * dz;
+    // Mining flicker below overrides this
+    cursor->color = COLOR_CURSOR;
+
+    const Contact *contact = find_contact(CONTACT_CURSOR_RESOURCE);
+    bool mining = contact && game.cursor_resource_val < CURSOR_RESOURCE_CAPACITY;
+
+    if (mining) {
+        int i = contact->b;
+        Entity *resource = &scene->resources[i];
+        game.cursor_is_mining = true;
+
+        // Flicker both resource and cursor color - welder effect
+        int flicker = rand() % 100;
+        if (flicker < 10) {
+            cursor->color = RGBA32(0, 0, 0, 255);
+        } else if (flicker < 40) {
+            resource->color = RGBA32(255, 255, 255, 255);
+            cursor->color = RGBA32(100, 100, 100, 255);
+        } else if (flicker < 70) {
+            resource->color = RGBA32(200, 200, 200, 255);
+            cursor->color = RGBA32(220, 220, 220, 255);
+        } else {
+            resource->color = COLOR_RESOURCE;
+            cursor->color = COLOR_CURSOR;
+        }
 
-        if (dist_sq < deflect_radius_sq) {
-            spawn_explosion(asteroids[i].position, COLOR_ASTEROID);
-            queue_message("Nice deflection! Fuel +5", 0.75f);
-            game.ship_fuel += 10.0f;
-            play_sfx(SFX_SHIP_HIT);
-            reset_asteroid(&asteroids[i]);
-            game.deflect_count++;
+        // Only play sound when mining starts
+        if (!cursor_was_mining) {
+            play_sfx(1);
+        }
+        game.cursor_mining_resource = i;
+        if (mine_resource(cursor, resource, delta_time)) {
+            mark_respawned(i);
         }
     }
+
+    cursor_was_mining = mining;
+}
+
+static void handle_drone_resource_contact(const CollisionScene *scene, float delta_time) {
+    Entity *drone = scene->drone;
+    game.drone_mining_resource = -1;
+    game.drone_collecting_resource = false;
+    game.drone_is_mining = false;
+
+    // Update drone_full based on current resource level
+    game.drone_full = (game.drone_resource_val >= DRONE_MAX_RESOURCES);
+
+    const Contact *contact = find_contact(CONTACT_DRONE_RESOURCE);
+    if (!contact || was_respawned(contact->b)) return;
+    if (game.drone_resource_val >= DRONE_MAX_RESOURCES) return;
+
+    int i = contact->b;
+    Entity *resource = &scene->resources[i];
+    game.drone_collecting_resource = true;
+    game.drone_is_mining = true;
+    trigger_rumble(0.01f);
+
+    drone->position.v[1] = resource->position.v[1] + 5.0f;
+    drone->position.v[0] = resource->position.v[0];
+    drone->position.v[2] = resource->position.v[2];
+
+    // Flicker resource color - welder effect
+    int flicker = rand() % 100;
+    if (flicker < 40) {
+        resource->color = RGBA32(111, 239, 255, 255);
+    } else if (flicker < 70) {
+        resource->color = RGBA32(200, 200, 200, 255);
+    } else {
+        resource->color = COLOR_RESOURCE;
+    }
+
+    game.drone_mining_resource = i;
+    if (drone_mine_resource(drone, resource, delta_time)) {
+        mark_respawned(i);
+    }
+}
+
+static void handle_tile_resource_contact(const CollisionScene *scene) {
+    if (game.drone_full) return;
+
+    const Contact *contact = find_contact(CONTACT_TILE_RESOURCE);
+    if (!contact || was_respawned(contact->b)) return;
+
+    // Start following this resource and send the drone to it
+    int i = contact->b;
+    game.tile_following_resource = i;
+    game.drone_target_position = scene->resources[i].position;
+    game.drone_target_rotation = 0.0f;
+    game.move_drone = true;
+    game.drone_moving_to_resource = true;
+    game.drone_moving_to_station = false;
+}
+
+void handle_resource_contacts(const CollisionScene *scene, float delta_time) {
+    handle_cursor_resource_contact(scene, delta_time);
+    handle_drone_resource_contact(scene, delta_time);
+    handle_tile_resource_contact(scene);
+}
+
+// =============================================================================
+// Contact Handlers - Asteroids
+// =============================================================================
+
+static void apply_ship_hit(Entity *cursor, const AsteroidStore *asteroids, int i, T3DVec3 impact) {
+    queue_message("Ouch!", 0.75f);
+    play_sfx(4);
+    float damage = calculate_asteroid_damage_opt(asteroids, i);
+    if (damage <= MAX_DAMAGE * ship_damage_multiplier) {
+        damage = MAX_DAMAGE * ship_damage_multiplier;
+    }
+    spawn_explosion(impact, COLOR_SPARKS);
+    cursor->value -= damage;
+    game.cursor_last_damage = (int)damage;
+
+    if (cursor->value < 0) {
+        cursor->value = 0;
+        game.disabled_controls = true;
+    } else if (cursor->value > 0 && game.ship_fuel > 0) {
+        game.disabled_controls = false;
+    }
+
+    // Add asteroid velocity to cursor velocity (knockback)
+    float inv_speed = (asteroids->speed[i] > 0.0f) ? 1.0f / asteroids->speed[i] : 0.0f;
+    game.cursor_velocity.v[0] += asteroids->vx[i] * inv_speed * KNOCKBACK_STRENGTH;
+    game.cursor_velocity.v[2] += asteroids->vz[i] * inv_speed * KNOCKBACK_STRENGTH;
+
+    other_shake_enabled = damage > 0 ? true : false;
+    if (other_shake_enabled) {
+        trigger_screen_shake(3.0f, 0.25f);
+    }
+
+    // Rumble based on damage (0.1s to 0.4s based on hit strength)
+    float rumble_duration = 0.1f + (damage / (MAX_DAMAGE * ship_damage_multiplier * 2.0f)) * 0.3f;
+    if (rumble_duration > 0.4f) rumble_duration = 0.4f;
+    trigger_rumble(rumble_duration);
+
+    game.cursor_iframe_timer = CURSOR_IFRAME_DURATION;
+}
+
+// One message/sound per check however many asteroids were caught
+static void handle_deflect_contacts(const CollisionScene *scene) {
+    int deflected = 0;
+
+    for (int c = 0; c < contact_count; c++) {
+        if (contacts[c].kind != CONTACT_DEFLECT_ASTEROID) continue;
+
+        spawn_explosion(contacts[c].point, COLOR_ASTEROID);
+        reset_asteroid(scene->asteroids, contacts[c].b);
+        deflected++;
+    }
+    if (deflected == 0) return;
+
+    game.ship_fuel += 10.0f * deflected;
+    game.deflect_count += deflected;
+    queue_message("Nice deflection! Fuel +5", 0.75f);
+    play_sfx(SFX_SHIP_HIT);
+}
+
+static void handle_cursor_asteroid_contacts(const CollisionScene *scene, float elapsed) {
+    if (game.deflect_active || game.cursor_is_mining) return;
+    if (game.cursor_iframe_timer > 0.0f) {
+        game.cursor_iframe_timer -= elapsed;
+    }
+
+    for (int c = 0; c < contact_count; c++) {
+        if (contacts[c].kind != CONTACT_CURSOR_ASTEROID) continue;
+
+        int i = contacts[c].b;
+        if (game.cursor_iframe_timer <= 0.0f) {
+            apply_ship_hit(scene->cursor, scene->asteroids, i, contacts[c].point);
+        }
+        reset_asteroid(scene->asteroids, i);
+    }
+}
+
+// asteroid_elapsed must match the value given to collect_contacts()
+void handle_asteroid_contacts(const CollisionScene *scene, float asteroid_elapsed) {
+    if (asteroid_elapsed <= 0.0f) return;
+
+    handle_deflect_contacts(scene);
+    handle_cursor_asteroid_contacts(scene, asteroid_elapsed);
 }
 
 // =============================================================================
-// Loader Asteroid Collisions (Optimized Asteroid struct)
+// Loader Asteroid Collisions (AsteroidStore)
 // =============================================================================
\ No newline at end of file
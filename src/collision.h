@@ -4,18 +4,55 @@
 #include "types.h"
 
 // =============================================================================
-// Color Flash System
+// Broad Phase
 // =============================================================================
 
-void start_entity_color_flash(Entity *entity, color_t flash_color, float duration_seconds);
-void update_color_flashes(float delta_time);
+// Rebuild the asteroid/resource grids - call once per tick after they move
+void build_collision_grids(const AsteroidStore *asteroids, Entity *resources, int resource_count);
 
 // =============================================================================
-// Cursor/Ship Collisions (Optimized Asteroid struct)
+// Contact Pipeline
 // =============================================================================
+// One broad-phase pass per tick gathers what the ship, drone, tile and deflect
+// field touched; the handlers then apply gameplay results from that list.
+
+typedef enum {
+    CONTACT_CURSOR_RESOURCE,
+    CONTACT_DRONE_RESOURCE,
+    CONTACT_TILE_RESOURCE,
+    CONTACT_DEFLECT_ASTEROID,
+    CONTACT_CURSOR_ASTEROID,
+} ContactKind;
+
+typedef struct {
+    uint8_t kind;             // ContactKind
+    uint8_t a;                // EntityID of the probe
+    uint16_t b;               // Index into the asteroid or resource array
+    T3DVec3 point;            // Where the contact happened (effects spawn here)
+} Contact;
+
+typedef struct {
+    Entity *cursor;
+    Entity *drone;
+    Entity *tile;
+    AsteroidStore *asteroids;
+    bool *asteroid_visible;
+    Entity *resources;
+    int resource_count;
+} CollisionScene;
+
+// asteroid_elapsed > 0 also sweeps the ship against asteroids over that many
+// seconds (time since the previous asteroid check); 0 skips them this tick
+int collect_contacts(const CollisionScene *scene, float asteroid_elapsed);
+void handle_resource_contacts(const CollisionScene *scene, float delta_time);
+void handle_asteroid_contacts(const CollisionScene *scene, float asteroid_elapsed);
 
-void check_cursor_asteroid_collisions_opt(Entity *cursor, Asteroid *asteroids, int count, bool *asteroid_visible, float delta_time);
-void check_cursor_asteroid_deflection_opt(Entity *cursor, Asteroid *asteroids, int count);
+// =============================================================================
+// Color Flash System
+// =============================================================================
+
+void start_entity_color_flash(Entity *entity, color_t flash_color, float duration_seconds);
+void update_color_flashes(float delta_time);
 
 // =============================================================================
 // Cursor/Ship Collisions (Legacy Entity struct)
@@ -23,14 +60,12 @@ void check_cursor_asteroid_deflection_opt(Entity *cursor, Asteroid *asteroids, i
 
 void check_cursor_asteroid_collisions(Entity *cursor, Entity *asteroids, int count, bool *asteroid_visible, float delta_time);
 void check_cursor_station_collision(Entity *cursor, Entity *station);
-void check_cursor_resource_collisions(Entity *cursor, Entity *resources, int count, float delta_time);
 void check_cursor_asteroid_deflection(Entity *cursor, Entity *asteroids, int count);
 
 // =============================================================================
 // Drone Collisions
 // =============================================================================
 
-void check_drone_resource_collisions(Entity *drone, Entity *resources, int count, float delta_time);
 void check_drone_station_collisions(Entity *drone, Entity *station, int count);
 void check_drone_cursor_collisions(Entity *drone, Entity *cursor, int count);
 
@@ -38,19 +73,13 @@ void check_drone_cursor_collisions(Entity *drone, Entity *cursor, int count);
 // Loader Collisions
 // =============================================================================
 
-void check_loader_asteroid_collisions_opt(Entity *loader, Asteroid *asteroids, int count, float delta_time);
-
-// =============================================================================
-// Tile Collisions
-// =============================================================================
-
-void check_tile_resource_collision(Entity *tile, Entity *resources, int count);
+void check_loader_asteroid_collisions_opt(Entity *loader, AsteroidStore *asteroids);
 
 // =============================================================================
 // Utility
 // =============================================================================
 
-float calculate_asteroid_damage_opt(Asteroid *asteroid);
+float calculate_asteroid_damage_opt(const AsteroidStore *asteroids, int index);
 float calculate_asteroid_damage(Entity *asteroid);
 void reset_resource_colors(Entity *resources, int count);
 
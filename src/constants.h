@@ -9,6 +9,11 @@
 
 #define SCREEN_WIDTH       320
 #define SCREEN_HEIGHT      240
+#define FB_COUNT           3        // Framebuffers; also depth of per-frame RCP buffers
+
+// tiny3d segments used to pass matrices by reference into recorded blocks
+#define ENTITY_MATRIX_SEGMENT   1
+#define ASTEROID_MATRIX_SEGMENT 2
 
 // =============================================================================
 // Camera
@@ -76,8 +81,11 @@
 // =============================================================================
 
 #define ASTEROID_BOUND_X   1000.0f
+#define ASTEROID_COLLISION_RADIUS 10.0f   // Same for all asteroids
+#define ASTEROID_EVENT_CAPACITY   128     // Per event heap (live + stale entries)
 #define ASTEROID_BOUND_Z   1000.0f
 #define ASTEROID_PADDING   100.0f
+#define ASTEROID_HEIGHT    10.0f          // Fixed Y for every asteroid
 
 // =============================================================================
 // Resource
@@ -111,6 +119,12 @@
 #define SHIP_DAMAGE_MULTIPLIER   3.0f
 #define SPAWN_INVINCIBILITY_TIME 3.0f
 
+// =============================================================================
+// Entity Pool
+// =============================================================================
+
+#define ENTITY_POOL_CAPACITY     64    // Fixed entities + resources + dynamic spawns
+
 // =============================================================================
 // Debug UI
 // =============================================================================
@@ -166,12 +180,24 @@
 #define MENU_OPTION_TUTORIAL 5
 #define MENU_OPTION_CREDITS  6
 #define MENU_OPTIONS_COUNT   7
+#define PAUSE_DIM_ALPHA      64   // Darkening of the frozen scene under menus (0 = off)
 
 // =============================================================================
 // Fixed Timestep
 // =============================================================================
 
-#define FIXED_TIMESTEP (1.0f / 60.0f)
+#define FIXED_TIMESTEP    (1.0f / 30.0f)  // Simulation tick (render is interpolated)
+#define MAX_SIM_SUBSTEPS  5                // Ticks per frame before dropping time
+#define INTERP_SNAP_DIST_SQ (64.0f * 64.0f) // Moved further in one tick = teleport, don't lerp
+
+// =============================================================================
+// Spatial Grid (collision broad phase)
+// =============================================================================
+
+#define SPATIAL_GRID_CELL_SIZE  64.0f
+#define SPATIAL_GRID_DIM        26       // Cells per side, covers +/- PLAY_AREA_RADIUS
+#define SPATIAL_GRID_MAX_ITEMS  512      // Per grid
+#define CONTACT_LIST_SIZE       128      // Contacts gathered per tick
 
 // =============================================================================
 // Background
@@ -207,9 +233,9 @@
 #define TRAIL_OFFSET_DISTANCE   14.0f     // How far behind ship to spawn
 #define TRAIL_PARTICLE_SIZE     0.02f     // Particle size
 #define TRAIL_LIFETIME          0.35f     // How long particles last
-#define TRAIL_SPREAD            5.0f      // Random spread amount
-#define TRAIL_PARTICLE_COUNT    2         // Particles per call (1-3 recommended)
 #define TRAIL_HEIGHT            5.0f      // Fixed height for trail particles
+#define TRAIL_SAMPLES           12        // Ring of ship positions (one per tick, covers TRAIL_LIFETIME)
+#define TRAIL_SUBDIVISIONS      2         // Sprites drawn per segment between samples
 
 #define ASTEROID_COUNT 30
 
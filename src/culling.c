@@ -0,0 +1,131 @@
+#include "culling.h"
+#include "constants.h"
+#include "camera.h"
+#include "entity_pool.h"
+#include <math.h>
+
+// =============================================================================
+// View Frustum
+// =============================================================================
+
+FrustumPlane frustum_planes[6];
+
+// Gribb/Hartmann: each plane is the clip-space w row plus or minus the x/y/z
+// row. T3DMat4 is column-major, so row r of the matrix is m[0..3][r].
+static void set_plane(FrustumPlane *plane, const T3DMat4 *mat, int row, float sign) {
+    float x = mat->m[0][3] + sign * mat->m[0][row];
+    float y = mat->m[1][3] + sign * mat->m[1][row];
+    float z = mat->m[2][3] + sign * mat->m[2][row];
+    float d = mat->m[3][3] + sign * mat->m[3][row];
+
+    float len_sq = x * x + y * y + z * z;
+    float inv_len = (len_sq > 0.000001f) ? 1.0f / sqrtf(len_sq) : 0.0f;
+    plane->x = x * inv_len;
+    plane->y = y * inv_len;
+    plane->z = z * inv_len;
+    plane->d = d * inv_len;
+}
+
+void update_frustum(const T3DViewport *viewport) {
+    T3DMat4 view_proj;
+    t3d_mat4_mul(&view_proj, &viewport->matProj, &viewport->matCamera);
+
+    set_plane(&frustum_planes[0], &view_proj, 0,  1.0f);  // Left
+    set_plane(&frustum_planes[1], &view_proj, 0, -1.0f);  // Right
+    set_plane(&frustum_planes[2], &view_proj, 1,  1.0f);  // Bottom
+    set_plane(&frustum_planes[3], &view_proj, 1, -1.0f);  // Top
+    set_plane(&frustum_planes[4], &view_proj, 2,  1.0f);  // Near
+    set_plane(&frustum_planes[5], &view_proj, 2, -1.0f);  // Far
+}
+
+// =============================================================================
+// Bounding Spheres
+// =============================================================================
+
+float get_model_bounding_radius(const T3DModel *model) {
+    if (!model) return 0.0f;
+
+    // Farthest AABB corner from the origin
+    float extent[3];
+    for (int axis = 0; axis < 3; axis++) {
+        float lo = fabsf((float)model->aabbMin[axis]);
+        float hi = fabsf((float)model->aabbMax[axis]);
+        extent[axis] = (lo > hi) ? lo : hi;
+    }
+    return sqrtf(extent[0] * extent[0] + extent[1] * extent[1] + extent[2] * extent[2]);
+}
+
+// =============================================================================
+// Array Culling
+// =============================================================================
+
+// Sphere around the midpoint of the last tick's motion
+static bool entity_sphere_visible(const Entity *e, float model_radius, float scale) {
+    const EntityRender *render = entity_render(e);
+    float mx = (e->position.v[0] + render->prev_position.v[0]) * 0.5f;
+    float my = (e->position.v[1] + render->prev_position.v[1]) * 0.5f;
+    float mz = (e->position.v[2] + render->prev_position.v[2]) * 0.5f;
+    float travel = fabsf(e->position.v[0] - mx) + fabsf(e->position.v[1] - my) + fabsf(e->position.v[2] - mz);
+    return render->model && frustum_sphere_visible(mx, my, mz, model_radius * scale + travel);
+}
+
+bool cull_entity(const Entity *entity, float render_scale) {
+    return entity_sphere_visible(entity, get_model_bounding_radius(entity_render(entity)->model),
+                                 render_scale);
+}
+
+int cull_entities(const Entity *entities, int count, bool *visible, float *distance_sq) {
+    // Resources etc. share one model, so the last radius is usually reusable
+    const T3DModel *last_model = NULL;
+    float model_radius = 0.0f;
+    int visible_count = 0;
+
+    for (int i = 0; i < count; i++) {
+        const Entity *e = &entities[i];
+        const EntityRender *render = entity_render(e);
+
+        if (render->model != last_model) {
+            last_model = render->model;
+            model_radius = get_model_bounding_radius(render->model);
+        }
+
+        float dx = e->position.v[0] - camera.position.v[0];
+        float dy = e->position.v[1] - camera.position.v[1];
+        float dz = e->position.v[2] - camera.position.v[2];
+        if (distance_sq) {
+            distance_sq[i] = dx * dx + dy * dy + dz * dz;
+        }
+
+        visible[i] = entity_sphere_visible(e, model_radius, e->scale);
+        visible_count += visible[i];
+    }
+    return visible_count;
+}
+
+int cull_asteroids(const AsteroidStore *asteroids, float model_radius, float max_distance_sq,
+                   bool *visible, float *distance_sq) {
+    const float *x = asteroids->x;
+    const float *z = asteroids->z;
+    const float *scale = asteroids->scale;
+    const float *speed = asteroids->speed;
+    float cam_x = camera.position.v[0];
+    float cam_y = camera.position.v[1];
+    float cam_z = camera.position.v[2];
+    float dy = ASTEROID_HEIGHT - cam_y;
+    int visible_count = 0;
+
+    for (int i = 0; i < asteroids->count; i++) {
+        float dx = x[i] - cam_x;
+        float dz = z[i] - cam_z;
+        float dist_sq = dx * dx + dy * dy + dz * dz;
+        distance_sq[i] = dist_sq;
+
+        // Drawn up to a tick behind its sim position along its path
+        float radius = model_radius * scale[i] + speed[i] * FIXED_TIMESTEP;
+
+        visible[i] = dist_sq < max_distance_sq &&
+                     frustum_sphere_visible(x[i], ASTEROID_HEIGHT, z[i], radius);
+        visible_count += visible[i];
+    }
+    return visible_count;
+}
@@ -0,0 +1,54 @@
+#ifndef CULLING_H
+#define CULLING_H
+
+#include <t3d/t3d.h>
+#include <t3d/t3dmodel.h>
+#include <stdbool.h>
+#include "types.h"
+
+// =============================================================================
+// View Frustum
+// =============================================================================
+// Six planes taken from the viewport's projection * camera matrix once per
+// frame - call update_frustum() after update_camera(). Normals point inward
+// and are normalized, so a plane evaluated at a point is its signed distance.
+
+typedef struct {
+    float x, y, z, d;
+} FrustumPlane;
+
+extern FrustumPlane frustum_planes[6];
+
+void update_frustum(const T3DViewport *viewport);
+
+static inline bool frustum_sphere_visible(float x, float y, float z, float radius) {
+    for (int p = 0; p < 6; p++) {
+        const FrustumPlane *plane = &frustum_planes[p];
+        if (plane->x * x + plane->y * y + plane->z * z + plane->d < -radius) return false;
+    }
+    return true;
+}
+
+// =============================================================================
+// Bounding Spheres
+// =============================================================================
+
+// Radius around the model origin that holds its AABB under any rotation (model units)
+float get_model_bounding_radius(const T3DModel *model);
+
+// =============================================================================
+// Array Culling
+// =============================================================================
+// One pass per array. Writes visible[i] and distance_sq[i] (squared distance
+// to the camera, the draw sort key; may be NULL) for every item and returns
+// the visible count. Spheres are padded by a tick of motion so interpolated
+// draws between the last two sim positions are never clipped.
+
+int cull_entities(const Entity *entities, int count, bool *visible, float *distance_sq);
+
+// One entity drawn at a scale other than entity->scale (largest axis)
+bool cull_entity(const Entity *entity, float render_scale);
+int cull_asteroids(const AsteroidStore *asteroids, float model_radius, float max_distance_sq,
+                   bool *visible, float *distance_sq);
+
+#endif // CULLING_H
@@ -4,6 +4,7 @@
 #include "utils.h"
 #include "camera.h"
 #include "types.h"
+#include "profiler.h"
 #include <rdpq.h>
 #include <malloc.h>
 #include <n64sys.h>
@@ -50,4 +51,8 @@ void render_debug_ui(T3DVec3 cursor_position, Entity entities[], Entity resource
     rdpq_text_printf(NULL, FONT_BUILTIN_DEBUG_MONO, DEBUG_TEXT_X, y,
                      "Disabled: %d", game.disabled_controls ? 1 : 0);
 
+    // Per-phase frame timeline (PROFILE=1 builds only)
+    y += DEBUG_LINE_HEIGHT * 2;
+    PROFILE_DRAW(DEBUG_TEXT_X, y);
+
 }
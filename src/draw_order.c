@@ -0,0 +1,65 @@
+#include "draw_order.h"
+
+// =============================================================================
+// Sorting
+// =============================================================================
+
+static uint16_t radix_scratch[DRAW_ORDER_CAPACITY];
+
+static void reset_order(DrawOrder *draw_order, int count) {
+    for (int i = 0; i < count; i++) {
+        draw_order->order[i] = (uint16_t)i;
+    }
+    draw_order->count = count;
+}
+
+// Cheap when the seed order is already close (few shifts per item)
+static void insertion_sort(uint16_t *order, const uint32_t *keys, int count) {
+    for (int i = 1; i < count; i++) {
+        uint16_t index = order[i];
+        uint32_t key = keys[index];
+        int j = i - 1;
+        while (j >= 0 && keys[order[j]] > key) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = index;
+    }
+}
+
+// One stable counting pass on the byte at `shift`
+static void radix_pass(const uint16_t *src, uint16_t *dst, const uint32_t *keys, int count, int shift) {
+    int offsets[256] = {0};
+    for (int i = 0; i < count; i++) {
+        offsets[(keys[src[i]] >> shift) & 0xFF]++;
+    }
+
+    int total = 0;
+    for (int b = 0; b < 256; b++) {
+        int n = offsets[b];
+        offsets[b] = total;
+        total += n;
+    }
+
+    for (int i = 0; i < count; i++) {
+        dst[offsets[(keys[src[i]] >> shift) & 0xFF]++] = src[i];
+    }
+}
+
+void draw_order_sort(DrawOrder *draw_order, const uint32_t *keys, int count) {
+    if (count > DRAW_ORDER_CAPACITY) count = DRAW_ORDER_CAPACITY;
+    if (count != draw_order->count) {
+        reset_order(draw_order, count);
+    }
+    if (count < 2) return;
+
+    if (count < DRAW_ORDER_RADIX_THRESHOLD) {
+        insertion_sort(draw_order->order, keys, count);
+    } else {
+        // LSD over the top 16 bits, then an insertion pass settles the
+        // low bits inside each bucket (already nearly in order)
+        radix_pass(draw_order->order, radix_scratch, keys, count, 16);
+        radix_pass(radix_scratch, draw_order->order, keys, count, 24);
+        insertion_sort(draw_order->order, keys, count);
+    }
+}
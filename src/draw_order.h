@@ -0,0 +1,35 @@
+#ifndef DRAW_ORDER_H
+#define DRAW_ORDER_H
+
+#include <stdint.h>
+#include <string.h>
+
+// =============================================================================
+// Draw Order
+// =============================================================================
+// Persistent index order for a population that is depth-sorted every frame.
+// Depth order barely changes between frames, so each sort starts from the
+// previous frame's order: an insertion pass over a nearly sorted list is close
+// to linear. Above DRAW_ORDER_RADIX_THRESHOLD items a two-pass radix sort on
+// the top 16 key bits (quantized depth) is used instead.
+
+#define DRAW_ORDER_CAPACITY        512
+#define DRAW_ORDER_RADIX_THRESHOLD 96
+
+typedef struct {
+    uint16_t order[DRAW_ORDER_CAPACITY];   // Item indices, ascending key after a sort
+    int count;                             // Population size the order was built for
+} DrawOrder;
+
+// Sort keys of non-negative floats compare the same as their bit patterns
+static inline uint32_t depth_sort_key(float distance_sq) {
+    uint32_t bits;
+    memcpy(&bits, &distance_sq, sizeof(bits));
+    return bits;
+}
+
+// Reorders draw_order->order so keys[order[i]] ascend. Equal keys keep their
+// previous relative order. A changed count restarts from identity.
+void draw_order_sort(DrawOrder *draw_order, const uint32_t *keys, int count);
+
+#endif // DRAW_ORDER_H
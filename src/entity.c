@@ -1,6 +1,8 @@
 #include "entity.h"
+#include "entity_pool.h"
 #include "camera.h"
 #include "utils.h"
+#include "game_state.h"
 #include <rdpq.h>
 #include <math.h>
 
@@ -8,52 +10,99 @@
 // Entity Creation
 // =============================================================================
 
-Entity create_entity(const char *model_path, T3DVec3 position, float scale,
-                     color_t color, DrawType draw_type, float collision_radius) {
-    Entity entity = {
-        .model = t3d_model_load(model_path),
-        .matrix = malloc_uncached(sizeof(T3DMat4FP)),
+void init_entity(Entity *entity, const char *model_path, T3DVec3 position, float scale,
+                 color_t color, DrawType draw_type, float collision_radius) {
+    init_entity_shared(entity, t3d_model_load(model_path), position, scale,
+                       color, draw_type, collision_radius);
+}
+
+// Entity with shared model (no model loading, reuses existing)
+void init_entity_shared(Entity *entity, T3DModel *shared_model, T3DVec3 position, float scale,
+                        color_t color, DrawType draw_type, float collision_radius) {
+    *entity = (Entity){
         .position = position,
-        .velocity = {{0.0f, 0.0f, 0.0f}},
-        .scale = scale,
-        .color = color,
         .rotation = {{0.0f, 0.0f, 0.0f}},
+        .scale = scale,
+        .velocity = {{0.0f, 0.0f, 0.0f}},
         .speed = 1.0f,
         .collision_radius = collision_radius,
         .value = 0,
-        .draw_type = draw_type,
+        .color = color,
     };
-    return entity;
-}
 
-// Create entity with shared model (no model loading, reuses existing)
-Entity create_entity_shared(T3DModel *shared_model, T3DVec3 position, float scale,
-                            color_t color, DrawType draw_type, float collision_radius) {
-    Entity entity = {
+    EntityRender *render = entity_render(entity);
+    *render = (EntityRender){
         .model = shared_model,
-        .matrix = malloc_uncached(sizeof(T3DMat4FP)),
-        .position = position,
-        .velocity = {{0.0f, 0.0f, 0.0f}},
-        .scale = scale,
-        .color = color,
-        .rotation = {{0.0f, 0.0f, 0.0f}},
-        .speed = 1.0f,
-        .collision_radius = collision_radius,
-        .value = 0,
+        .matrix = render->matrix,
+        .block = NULL,
         .draw_type = draw_type,
+        .prev_position = position,
+        .prev_rotation = {{0.0f, 0.0f, 0.0f}},
     };
-    return entity;
+}
+
+EntityHandle spawn_entity_shared(T3DModel *shared_model, T3DVec3 position, float scale,
+                                 color_t color, DrawType draw_type, float collision_radius) {
+    EntityHandle handle = entity_pool_alloc();
+    Entity *entity = entity_pool_get(handle);
+    if (entity) {
+        init_entity_shared(entity, shared_model, position, scale, color, draw_type, collision_radius);
+    }
+    return handle;
 }
 
 // =============================================================================
 // Entity Matrix Updates
 // =============================================================================
 
+// Matrix slot for the frame currently being built
+T3DMat4FP *get_entity_matrix(Entity *entity) {
+    return &entity_render(entity)->matrix[game.frame_idx];
+}
+
+static inline bool same_vec3(const float *a, const float *b) {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+// An entity that did not move last tick has the same transform at every alpha,
+// so each of the FB_COUNT slots is built once and then reused until position,
+// rotation or scale change. Moving entities rebuild every frame as before; for
+// them the check is at most six float compares (usually exiting on the first)
+// against a rebuild's three sin/cos pairs and fixed-point conversion.
+void build_entity_matrix(Entity *entity, float alpha, const float scale[3]) {
+    EntityRender *render = entity_render(entity);
+    uint8_t slot_bit = 1 << game.frame_idx;
+
+    bool moving = !same_vec3(entity->position.v, render->prev_position.v) ||
+                  !same_vec3(entity->rotation.v, render->prev_rotation.v);
+
+    if (moving) {
+        render->built_slots = 0;
+
+        T3DVec3 position, rotation;
+        get_entity_interpolated(entity, alpha, &position, &rotation);
+        t3d_mat4fp_from_srt_euler(get_entity_matrix(entity), scale, rotation.v, position.v);
+        return;
+    }
+
+    if (!same_vec3(entity->position.v, render->built_position.v) ||
+        !same_vec3(entity->rotation.v, render->built_rotation.v) ||
+        !same_vec3(scale, render->built_scale.v)) {
+        render->built_position = entity->position;
+        render->built_rotation = entity->rotation;
+        render->built_scale = (T3DVec3){{scale[0], scale[1], scale[2]}};
+        render->built_slots = 0;
+    } else if (render->built_slots & slot_bit) {
+        return;
+    }
+
+    t3d_mat4fp_from_srt_euler(get_entity_matrix(entity), scale, entity->rotation.v, entity->position.v);
+    render->built_slots |= slot_bit;
+}
+
+// Current transform (alpha 1)
 void update_entity_matrix(Entity *entity) {
-    t3d_mat4fp_from_srt_euler(entity->matrix,
-        (float[3]){entity->scale, entity->scale, entity->scale},
-        (float[3]){entity->rotation.v[0], entity->rotation.v[1], entity->rotation.v[2]},
-        entity->position.v);
+    build_entity_matrix(entity, 1.0f, (float[3]){entity->scale, entity->scale, entity->scale});
 }
 
 void update_entity_matrices(Entity *entity_array, int count) {
@@ -62,6 +111,55 @@ void update_entity_matrices(Entity *entity_array, int count) {
     }
 }
 
+// =============================================================================
+// Render Interpolation
+// =============================================================================
+
+// Snapshot the current transform as the previous sim tick
+void save_entity_states(Entity *entity_array, int count) {
+    for (int i = 0; i < count; i++) {
+        EntityRender *render = entity_render(&entity_array[i]);
+        render->prev_position = entity_array[i].position;
+        render->prev_rotation = entity_array[i].rotation;
+    }
+}
+
+// Blend between the previous and current sim tick (alpha 0 = previous, 1 = current)
+void get_entity_interpolated(Entity *entity, float alpha, T3DVec3 *out_position, T3DVec3 *out_rotation) {
+    const EntityRender *render = entity_render(entity);
+    float dx = entity->position.v[0] - render->prev_position.v[0];
+    float dy = entity->position.v[1] - render->prev_position.v[1];
+    float dz = entity->position.v[2] - render->prev_position.v[2];
+
+    // Respawns and snaps would smear across the map - show them as-is
+    if (dx * dx + dy * dy + dz * dz > INTERP_SNAP_DIST_SQ) {
+        *out_position = entity->position;
+        *out_rotation = entity->rotation;
+        return;
+    }
+
+    float back = 1.0f - alpha;
+    out_position->v[0] = entity->position.v[0] - dx * back;
+    out_position->v[1] = entity->position.v[1] - dy * back;
+    out_position->v[2] = entity->position.v[2] - dz * back;
+
+    // Shortest way round so wrapped angles don't spin backwards
+    for (int i = 0; i < 3; i++) {
+        float diff = normalize_angle(entity->rotation.v[i] - render->prev_rotation.v[i]);
+        out_rotation->v[i] = entity->rotation.v[i] - diff * back;
+    }
+}
+
+void update_entity_matrix_interpolated(Entity *entity, float alpha) {
+    build_entity_matrix(entity, alpha, (float[3]){entity->scale, entity->scale, entity->scale});
+}
+
+void update_entity_matrices_interpolated(Entity *entity_array, int count, float alpha) {
+    for (int i = 0; i < count; i++) {
+        update_entity_matrix_interpolated(&entity_array[i], alpha);
+    }
+}
+
 // =============================================================================
 // Entity Rotation
 // =============================================================================
@@ -77,12 +175,28 @@ void rotate_entity(Entity *entity, float delta_time, float speed) {
 // Entity Drawing
 // =============================================================================
 
+void set_entity_combiner(DrawType draw_type) {
+    if (draw_type == DRAW_FLAT) {
+        rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
+    } else if (draw_type == DRAW_SHADED) {
+        rdpq_mode_combiner(RDPQ_COMBINER1((PRIM, 0, SHADE, 0), (PRIM, 0, SHADE, 0)));
+    } else {
+        // Textured lit - texture with vertex shading
+        rdpq_mode_combiner(RDPQ_COMBINER1((TEX0, 0, SHADE, 0), (TEX0, 0, SHADE, 0)));
+    }
+}
+
+static void set_entity_material(color_t color, DrawType draw_type) {
+    rdpq_set_prim_color(color);
+    set_entity_combiner(draw_type);
+}
+
 void draw_entity(Entity *entity) {
     draw_entity_with_fade(entity, 0.0f);
 }
 
 void draw_entity_with_fade(Entity *entity, float fade_distance) {
-    t3d_matrix_push(entity->matrix);
+    t3d_matrix_push(get_entity_matrix(entity));
 
     color_t render_color = entity->color;
 
@@ -114,18 +228,10 @@ void draw_entity_with_fade(Entity *entity, float fade_distance) {
         render_color = RGBA32(r, g, b, a);
     }
 
-    rdpq_set_prim_color(render_color);
+    const EntityRender *render = entity_render(entity);
+    set_entity_material(render_color, render->draw_type);
 
-    if (entity->draw_type == DRAW_FLAT) {
-        rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
-    } else if (entity->draw_type == DRAW_SHADED) {
-        rdpq_mode_combiner(RDPQ_COMBINER1((PRIM, 0, SHADE, 0), (PRIM, 0, SHADE, 0)));
-    } else {
-        // Textured lit - texture with vertex shading
-        rdpq_mode_combiner(RDPQ_COMBINER1((TEX0, 0, SHADE, 0), (TEX0, 0, SHADE, 0)));
-    }
-
-    t3d_model_draw(entity->model);
+    t3d_model_draw(render->model);
     t3d_matrix_pop(1);
 }
 
@@ -135,6 +241,40 @@ void draw_entities(Entity *entity_array, int count) {
     }
 }
 
+// =============================================================================
+// Cached Entity Drawing
+// =============================================================================
+
+// Geometry only (matrix push, model, pop) - material state is set by the caller,
+// so the block never needs re-recording. The block pushes a segment placeholder;
+// the frame's matrix slot is bound to the segment right before each run.
+void draw_entity_block(Entity *entity) {
+    EntityRender *render = entity_render(entity);
+    if (!render->block) {
+        rspq_block_begin();
+        t3d_matrix_push(t3d_segment_placeholder(ENTITY_MATRIX_SEGMENT));
+        t3d_model_draw(render->model);
+        t3d_matrix_pop(1);
+        render->block = rspq_block_end();
+    }
+
+    t3d_segment_set(ENTITY_MATRIX_SEGMENT, get_entity_matrix(entity));
+    rspq_block_run(render->block);
+}
+
+// Same output as draw_entity(), replaying a pre-recorded block for the geometry
+void draw_entity_cached(Entity *entity) {
+    set_entity_material(entity->color, entity_render(entity)->draw_type);
+    draw_entity_block(entity);
+}
+
+// Plain push/draw/pop without touching material state
+void draw_entity_mesh(Entity *entity) {
+    t3d_matrix_push(get_entity_matrix(entity));
+    t3d_model_draw(entity_render(entity)->model);
+    t3d_matrix_pop(1);
+}
+
 // =============================================================================
 // Entity Collision
 // =============================================================================
@@ -156,24 +296,37 @@ bool check_entity_intersection(Entity *a, Entity *b) {
 // Entity Cleanup
 // =============================================================================
 
-void free_entity(Entity *entity) {
-    if (entity->model) {
-        t3d_model_free(entity->model);
-        entity->model = NULL;
+static void free_entity_block(Entity *entity) {
+    EntityRender *render = entity_render(entity);
+    if (render->block) {
+        rspq_wait();
+        rspq_block_free(render->block);
+        render->block = NULL;
     }
-    if (entity->matrix) {
-        free_uncached(entity->matrix);
-        entity->matrix = NULL;
+}
+
+// Matrices belong to the pool slot and are freed with the pool
+void free_entity(Entity *entity) {
+    free_entity_block(entity);
+    EntityRender *render = entity_render(entity);
+    if (render->model) {
+        t3d_model_free(render->model);
+        render->model = NULL;
     }
 }
 
 // Free entity that uses a shared model (don't free the model)
 void free_entity_shared(Entity *entity) {
-    entity->model = NULL;  // Don't free shared model
-    if (entity->matrix) {
-        free_uncached(entity->matrix);
-        entity->matrix = NULL;
-    }
+    free_entity_block(entity);
+    entity_render(entity)->model = NULL;  // Don't free shared model
+}
+
+// Returns a dynamic (shared-model) entity's slot to the pool
+void despawn_entity(EntityHandle handle) {
+    Entity *entity = entity_pool_get(handle);
+    if (!entity) return;
+    free_entity_shared(entity);
+    entity_pool_release(handle);
 }
 
 void free_all_entities(Entity *entity_array, int count) {
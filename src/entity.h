@@ -8,20 +8,43 @@
 // Entity Creation
 // =============================================================================
 
-Entity create_entity(const char *model_path, T3DVec3 position, float scale,
-                     color_t color, DrawType draw_type, float collision_radius);
+// Fill in a pool slot (see entity_pool.h); the slot keeps its own matrices
+void init_entity(Entity *entity, const char *model_path, T3DVec3 position, float scale,
+                 color_t color, DrawType draw_type, float collision_radius);
 
-// Create entity with shared model (doesn't load new model, uses provided one)
-Entity create_entity_shared(T3DModel *shared_model, T3DVec3 position, float scale,
-                            color_t color, DrawType draw_type, float collision_radius);
+// Same, with a shared model (doesn't load new model, uses provided one)
+void init_entity_shared(Entity *entity, T3DModel *shared_model, T3DVec3 position, float scale,
+                        color_t color, DrawType draw_type, float collision_radius);
+
+// Dynamic entities: O(1), from the pool's free list. The handle goes stale on
+// despawn, so callers holding one across frames must check entity_pool_get().
+EntityHandle spawn_entity_shared(T3DModel *shared_model, T3DVec3 position, float scale,
+                                 color_t color, DrawType draw_type, float collision_radius);
+void despawn_entity(EntityHandle handle);
 
 // =============================================================================
 // Entity Matrix Updates
 // =============================================================================
 
+T3DMat4FP *get_entity_matrix(Entity *entity);
+
+// Fills this frame's slot with the interpolated transform at `scale` (per-axis,
+// so draw-time overrides go through the same path). Skipped when the slot
+// already holds an unchanged, stationary transform.
+void build_entity_matrix(Entity *entity, float alpha, const float scale[3]);
+
 void update_entity_matrix(Entity *entity);
 void update_entity_matrices(Entity *entity_array, int count);
 
+// =============================================================================
+// Render Interpolation (between the last two fixed sim ticks)
+// =============================================================================
+
+void save_entity_states(Entity *entity_array, int count);
+void get_entity_interpolated(Entity *entity, float alpha, T3DVec3 *out_position, T3DVec3 *out_rotation);
+void update_entity_matrix_interpolated(Entity *entity, float alpha);
+void update_entity_matrices_interpolated(Entity *entity_array, int count, float alpha);
+
 // =============================================================================
 // Entity Rotation
 // =============================================================================
@@ -35,6 +58,14 @@ void rotate_entity(Entity *entity, float delta_time, float speed);
 void draw_entity(Entity *entity);
 void draw_entity_with_fade(Entity *entity, float fade_distance);
 void draw_entities(Entity *entity_array, int count);
+void set_entity_combiner(DrawType draw_type);
+
+// Static geometry: replays a pre-recorded block
+void draw_entity_cached(Entity *entity);
+
+// Geometry only, for callers that manage prim color/combiner themselves
+void draw_entity_block(Entity *entity);
+void draw_entity_mesh(Entity *entity);
 
 // =============================================================================
 // Entity Collision
@@ -0,0 +1,135 @@
+#include "entity_pool.h"
+#include <libdragon.h>
+
+// The fixed entity and resource arrays are reserved up front
+_Static_assert(ENTITY_COUNT + RESOURCE_COUNT <= ENTITY_POOL_CAPACITY, "ENTITY_POOL_CAPACITY too small");
+
+// =============================================================================
+// Static Data
+// =============================================================================
+
+Entity entity_slots[ENTITY_POOL_CAPACITY];
+EntityRender entity_render_slots[ENTITY_POOL_CAPACITY];
+static uint16_t generations[ENTITY_POOL_CAPACITY];
+static bool live[ENTITY_POOL_CAPACITY];
+static uint16_t free_list[ENTITY_POOL_CAPACITY];
+static int free_count = 0;
+static int live_count = 0;
+static int static_count = 0;                  // Slots [0, static_count) are never released
+static uint16_t dynamic_live[ENTITY_POOL_CAPACITY];  // Packed live dynamic slots
+static uint16_t dynamic_pos[ENTITY_POOL_CAPACITY];   // Slot -> index in dynamic_live
+static int dynamic_count = 0;
+static T3DMat4FP *slot_matrices = NULL;       // ENTITY_POOL_CAPACITY * FB_COUNT
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+void entity_pool_init(int reserved_count) {
+    static_count = reserved_count;
+
+    if (!slot_matrices) {
+        slot_matrices = malloc_uncached(sizeof(T3DMat4FP) * FB_COUNT * ENTITY_POOL_CAPACITY);
+    }
+
+    for (int i = 0; i < ENTITY_POOL_CAPACITY; i++) {
+        entity_slots[i] = (Entity){0};
+        entity_render_slots[i] = (EntityRender){ .matrix = &slot_matrices[i * FB_COUNT] };
+        generations[i] = 1;
+        live[i] = i < static_count;
+    }
+
+    // Pushed high to low so dynamic slots are handed out in ascending order
+    free_count = 0;
+    for (int i = ENTITY_POOL_CAPACITY - 1; i >= static_count; i--) {
+        free_list[free_count++] = (uint16_t)i;
+    }
+    live_count = static_count;
+    dynamic_count = 0;
+}
+
+void entity_pool_free(void) {
+    if (slot_matrices) {
+        free_uncached(slot_matrices);
+        slot_matrices = NULL;
+    }
+    free_count = 0;
+    live_count = 0;
+    static_count = 0;
+    dynamic_count = 0;
+}
+
+Entity *entity_pool_slot(int index) {
+    return &entity_slots[index];
+}
+
+// =============================================================================
+// Handles
+// =============================================================================
+
+static void bump_generation(int index) {
+    generations[index]++;
+    if (generations[index] == 0) generations[index] = 1;
+}
+
+EntityHandle entity_pool_alloc(void) {
+    if (free_count == 0) return ENTITY_HANDLE_NONE;
+
+    uint16_t index = free_list[--free_count];
+    entity_slots[index] = (Entity){0};
+    entity_render_slots[index] = (EntityRender){ .matrix = entity_render_slots[index].matrix };
+    live[index] = true;
+    live_count++;
+    dynamic_pos[index] = (uint16_t)dynamic_count;
+    dynamic_live[dynamic_count++] = index;
+    return (EntityHandle){ index, generations[index] };
+}
+
+void entity_pool_release(EntityHandle handle) {
+    if (handle.index < static_count || !entity_pool_get(handle)) return;
+
+    bump_generation(handle.index);
+    live[handle.index] = false;
+    live_count--;
+    free_list[free_count++] = handle.index;
+
+    uint16_t pos = dynamic_pos[handle.index];
+    uint16_t last = dynamic_live[--dynamic_count];
+    dynamic_live[pos] = last;
+    dynamic_pos[last] = pos;
+}
+
+int entity_pool_live_count(void) {
+    return live_count;
+}
+
+int entity_pool_dynamic_count(void) {
+    return dynamic_count;
+}
+
+Entity *entity_pool_dynamic(int i) {
+    return &entity_slots[dynamic_live[i]];
+}
+
+EntityHandle entity_pool_dynamic_handle(int i) {
+    uint16_t index = dynamic_live[i];
+    return (EntityHandle){ index, generations[index] };
+}
+
+Entity *entity_pool_get(EntityHandle handle) {
+    if (handle.index >= ENTITY_POOL_CAPACITY) return NULL;
+    if (!live[handle.index] || generations[handle.index] != handle.generation) return NULL;
+    return &entity_slots[handle.index];
+}
+
+EntityHandle entity_pool_handle_of(const Entity *entity) {
+    if (entity < entity_slots || entity >= entity_slots + ENTITY_POOL_CAPACITY) return ENTITY_HANDLE_NONE;
+
+    uint16_t index = (uint16_t)(entity - entity_slots);
+    return (EntityHandle){ index, generations[index] };
+}
+
+void entity_pool_invalidate(Entity *entity) {
+    if (entity < entity_slots || entity >= entity_slots + ENTITY_POOL_CAPACITY) return;
+    bump_generation(entity - entity_slots);
+}
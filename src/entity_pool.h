@@ -0,0 +1,50 @@
+#ifndef ENTITY_POOL_H
+#define ENTITY_POOL_H
+
+#include "types.h"
+#include "constants.h"
+
+// =============================================================================
+// Entity Pool
+// =============================================================================
+// Contiguous storage for every Entity, with its EntityRender in a parallel
+// array at the same index. Slots [0, static_count) are reserved at
+// init for the fixed arrays and stay live; the rest are handed out from a free
+// list. Each slot owns its FB_COUNT matrices from one uncached block, so
+// spawning and despawning never allocate and never move an entity.
+
+extern Entity entity_slots[ENTITY_POOL_CAPACITY];
+extern EntityRender entity_render_slots[ENTITY_POOL_CAPACITY];
+
+// Render component of a pooled entity
+static inline EntityRender *entity_render(const Entity *entity) {
+    return &entity_render_slots[entity - entity_slots];
+}
+
+void entity_pool_init(int static_count);
+void entity_pool_free(void);
+
+// Reserved slots, by index
+Entity *entity_pool_slot(int index);
+
+// Dynamic slots. Alloc returns ENTITY_HANDLE_NONE when the pool is full;
+// both components are zeroed apart from the matrices. Releasing a handle to a
+// reserved slot is ignored.
+EntityHandle entity_pool_alloc(void);
+void entity_pool_release(EntityHandle handle);
+int entity_pool_live_count(void);
+
+// Live dynamic entities, packed for iteration. Release swaps the last one into
+// the hole, so loops that despawn must walk backwards.
+int entity_pool_dynamic_count(void);
+Entity *entity_pool_dynamic(int i);
+EntityHandle entity_pool_dynamic_handle(int i);
+
+// NULL once the slot has been released or respawned
+Entity *entity_pool_get(EntityHandle handle);
+EntityHandle entity_pool_handle_of(const Entity *entity);
+
+// For entities respawned in place: outstanding handles go stale
+void entity_pool_invalidate(Entity *entity);
+
+#endif // ENTITY_POOL_H
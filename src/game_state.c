@@ -78,6 +78,7 @@ GameStateData game = {
 
     // Frame counting
     .frame_count = 0,
+    .frame_idx = 0,
 
     // Time accumulators
     .particle_render_timer = 0.0f,
@@ -87,6 +88,7 @@ GameStateData game = {
 
     // Fixed timestep
     .accumulator = 0.0f,
+    .render_alpha = 1.0f,
     .reset = false,
     // Deflection state
     .deflect_timer = 0.0f,
@@ -115,6 +117,7 @@ GameStateData game = {
     // Status message queue
     .status_message = "",
     .status_message_timer = 0.0f,
+    .status_message_id = 0,
     .message_queue = {{0}},
     .message_queue_timers = {0},
     .message_queue_count = 0
@@ -167,6 +170,12 @@ void set_game_over(void) {
     game.game_over = true;
 }
 
+// Step to the next per-frame buffer slot. The RCP may still be drawing the
+// previous FB_COUNT-1 frames, so their slots must not be written.
+void advance_frame_index(void) {
+    game.frame_idx = (game.frame_idx + 1) % FB_COUNT;
+}
+
 // =============================================================================
 // Difficulty Progression
 // =============================================================================
@@ -214,6 +223,7 @@ void queue_message(const char *message, float duration) {
         strncpy(game.status_message, message, sizeof(game.status_message) - 1);
         game.status_message[sizeof(game.status_message) - 1] = '\0';
         game.status_message_timer = duration;
+        game.status_message_id++;
         return;
     }
 
@@ -239,6 +249,7 @@ void update_message_queue(float delta_time) {
                 strncpy(game.status_message, game.message_queue[0], sizeof(game.status_message) - 1);
                 game.status_message[sizeof(game.status_message) - 1] = '\0';
                 game.status_message_timer = game.message_queue_timers[0];
+                game.status_message_id++;
 
                 // Shift remaining messages down using memmove (safe for overlapping)
                 for (int i = 0; i < game.message_queue_count - 1; i++) {
@@ -93,6 +93,7 @@ typedef struct {
 
     // Frame counting
     int frame_count;
+    int frame_idx;          // Slot (0..FB_COUNT-1) for per-frame RCP data
 
     // Time accumulators for throttled updates
     float particle_render_timer;
@@ -102,6 +103,7 @@ typedef struct {
 
     // Fixed timestep accumulator
     float accumulator;
+    float render_alpha;     // Fraction of a tick between the last two sim states
 
     bool reset;
         // Deflection state
@@ -132,6 +134,7 @@ typedef struct {
     // Status message queue
     char status_message[64];           // Current displayed message
     float status_message_timer;        // Timer for current message
+    int status_message_id;             // Bumped whenever status_message changes (HUD cache key)
     char message_queue[5][64];         // Queue of pending messages
     float message_queue_timers[5];     // Duration for each queued message
     int message_queue_count;           // Number of messages in queue
@@ -172,6 +175,7 @@ void pause_game(void);
 void unpause_game(void);
 void set_game_over(void);
 void update_difficulty(float delta_time);
+void advance_frame_index(void);
 float get_asteroid_speed_for_difficulty(void);
 
 // Message queue functions
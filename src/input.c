@@ -193,11 +193,12 @@ void process_menu_input(void) {
 
             case MENU_OPTION_HIRES:
                 game.hi_res_mode = !game.hi_res_mode;
+                rspq_wait();  // Frames may still be in flight
                 display_close();
                 if (game.hi_res_mode) {
-                    display_init(RESOLUTION_640x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
+                    display_init(RESOLUTION_640x240, DEPTH_16_BPP, FB_COUNT, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
                 } else {
-                    display_init(RESOLUTION_320x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
+                    display_init(RESOLUTION_320x240, DEPTH_16_BPP, FB_COUNT, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
                 }
                 break;
 
@@ -273,7 +274,7 @@ void process_system_input(T3DViewport *viewport) {
 
         // Recreate viewport if resolution changed
         if (input.pressed.a && game.menu_selection == MENU_OPTION_HIRES) {
-            *viewport = t3d_viewport_create();
+            *viewport = t3d_viewport_create_buffered(FB_COUNT);
         }
         return;
     }
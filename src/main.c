@@ -26,15 +26,19 @@
 #include "collision.h"
 #include "input.h"
 #include "ui.h"
+#include "profiler.h"
+#include "render_queue.h"
+#include "culling.h"
+#include "entity_pool.h"
 
 // =============================================================================
 // Entity Arrays (not in game_state - too large)
 // =============================================================================
 
-
-static Entity entities[ENTITY_COUNT];
-static Asteroid asteroids[ASTEROID_COUNT];  // Optimized asteroid struct
-static Entity resources[RESOURCE_COUNT];
+// Reserved slots at the front of the entity pool: ENTITY_COUNT, then RESOURCE_COUNT
+static Entity *entities = NULL;
+static AsteroidStore asteroids;             // Optimized asteroid store (SoA)
+static Entity *resources = NULL;
 static Entity *cursor_entity = NULL;
 static Entity *jets_entity = NULL;
 
@@ -47,169 +51,61 @@ static bool resource_visible[RESOURCE_COUNT];
 // =============================================================================
 
 static int culled_count = 0;
-
-static bool is_entity_in_frustum(Entity *entity, T3DVec3 cam_position, T3DVec3 cam_target, float fov_degrees) {
-    float dx = entity->position.v[0] - cam_position.v[0];
-    float dy = entity->position.v[1] - cam_position.v[1];
-    float dz = entity->position.v[2] - cam_position.v[2];
-
-    float distance_sq = dx * dx + dy * dy + dz * dz;
-    if (distance_sq < 0.000001f) return true;
-
-    float inv_dist = fast_inv_sqrt(distance_sq);
-    dx *= inv_dist;
-    dy *= inv_dist;
-    dz *= inv_dist;
-
-    float fx = cam_target.v[0] - cam_position.v[0];
-    float fy = cam_target.v[1] - cam_position.v[1];
-    float fz = cam_target.v[2] - cam_position.v[2];
-
-    float forward_len_sq = fx * fx + fy * fy + fz * fz;
-    if (forward_len_sq < 0.000001f) return true;
-
-    float inv_forward = fast_inv_sqrt(forward_len_sq);
-    fx *= inv_forward;
-    fy *= inv_forward;
-    fz *= inv_forward;
-
-    float dot = dx * fx + dy * fy + dz * fz;
-
-    float half_fov_rad = T3D_DEG_TO_RAD(fov_degrees * 0.5f);
-    float cos_threshold = cosf(half_fov_rad * 1.2f);
-
-    if (dot < cos_threshold) {
-        return false;
-    }
-
-    float distance = 1.0f / inv_dist;
-    float radius = entity->scale * 50.0f;
-    if (distance - radius > CAM_FAR_PLANE) {
-        return false;
-    }
-
-    return true;
-}
-
-static void compute_visibility(Entity *entity_array, bool *visibility, int count) {
-    for (int i = 0; i < count; i++) {
-        visibility[i] = is_entity_in_frustum(&entity_array[i], camera.position, camera.target, CAM_DEFAULT_FOV);
-    }
-}
-
-// Asteroid-specific visibility with distance culling (uses optimized Asteroid struct)
+static bool entity_visible[ENTITY_COUNT];
+static bool dynamic_visible[ENTITY_POOL_CAPACITY];  // Indexed like entity_pool_dynamic()
 static float asteroid_distance_sq[ASTEROID_COUNT];
 
-static bool is_asteroid_in_frustum(Asteroid *asteroid, T3DVec3 cam_position, T3DVec3 cam_target, float fov_degrees) {
-    float dx = asteroid->position.v[0] - cam_position.v[0];
-    float dy = asteroid->position.v[1] - cam_position.v[1];
-    float dz = asteroid->position.v[2] - cam_position.v[2];
-
-    float distance_sq = dx * dx + dy * dy + dz * dz;
-    if (distance_sq < 0.000001f) return true;
-
-    float inv_dist = fast_inv_sqrt(distance_sq);
-    dx *= inv_dist;
-    dy *= inv_dist;
-    dz *= inv_dist;
-
-    float fx = cam_target.v[0] - cam_position.v[0];
-    float fy = cam_target.v[1] - cam_position.v[1];
-    float fz = cam_target.v[2] - cam_position.v[2];
-
-    float forward_len_sq = fx * fx + fy * fy + fz * fz;
-    if (forward_len_sq < 0.000001f) return true;
-
-    float inv_forward = fast_inv_sqrt(forward_len_sq);
-    fx *= inv_forward;
-    fy *= inv_forward;
-    fz *= inv_forward;
-
-    float dot = dx * fx + dy * fy + dz * fz;
-
-    float half_fov_rad = T3D_DEG_TO_RAD(fov_degrees * 0.5f);
-    float cos_threshold = cosf(half_fov_rad * 1.2f);
-
-    if (dot < cos_threshold) {
-        return false;
-    }
-
-    float distance = 1.0f / inv_dist;
-    float radius = asteroid->scale * 50.0f;
-    if (distance - radius > CAM_FAR_PLANE) {
-        return false;
-    }
-
-    return true;
+static bool tile_scale_animated(void) {
+    return game.drone_moving_to_station || game.move_drone || game.tile_following_resource >= 0;
 }
 
-static void compute_asteroid_visibility(Asteroid *asteroids, bool *visibility, int count) {
-    for (int i = 0; i < count; i++) {
-        // Calculate distance from CAMERA (not cursor) for proper culling
-        float dx = asteroids[i].position.v[0] - camera.position.v[0];
-        float dz = asteroids[i].position.v[2] - camera.position.v[2];
-        float dist_sq = dx * dx + dz * dz;
-        asteroid_distance_sq[i] = dist_sq;
-
-        // Too far from camera - don't draw at all
-        if (dist_sq > ASTEROID_DRAW_DISTANCE_SQ) {
-            visibility[i] = false;
-        } else {
-            // Within range - check frustum
-            visibility[i] = is_asteroid_in_frustum(&asteroids[i], camera.position, camera.target, CAM_DEFAULT_FOV);
-        }
+// Once per frame, after the camera has moved
+static void cull_scene(T3DViewport *viewport) {
+    update_frustum(viewport);
+    cull_entities(entities, ENTITY_COUNT, entity_visible, NULL);
+    if (tile_scale_animated() && game.tile_scale_multiplier > 1.0f) {
+        // Drawn with XZ scaled by the multiplier (see build_frame_matrices)
+        Entity *tile = &entities[ENTITY_TILE];
+        entity_visible[ENTITY_TILE] = cull_entity(tile, tile->scale * game.tile_scale_multiplier);
     }
+    cull_entities(resources, RESOURCE_COUNT, resource_visible, NULL);
+    for (int i = 0; i < entity_pool_dynamic_count(); i++) {
+        cull_entities(entity_pool_dynamic(i), 1, &dynamic_visible[i], NULL);
+    }
+    cull_asteroids(&asteroids, get_asteroid_model_radius(), ASTEROID_DRAW_DISTANCE_SQ,
+                   asteroid_visible, asteroid_distance_sq);
 }
 
 // =============================================================================
-// Entity Drawing with Culling and Sorting
+// Entity Queueing with Culling
 // =============================================================================
 
-typedef struct {
-    int index;
-    float distance_sq;
-} EntityDistance;
-
-static int compare_distance(const void *a, const void *b) {
-    const EntityDistance *ea = (const EntityDistance *)a;
-    const EntityDistance *eb = (const EntityDistance *)b;
-    if (ea->distance_sq < eb->distance_sq) return -1;
-    if (ea->distance_sq > eb->distance_sq) return 1;
-    return 0;
-}
-
-static void draw_entities_sorted(Entity *entity_array, int count, bool *skip_culling, bool *visibility) {
-    static EntityDistance sorted_indices[64];
-    int visible_count = 0;
-
-    for (int i = 0; i < count && visible_count < 64; i++) {
-        bool should_draw = false;
-
-        if (skip_culling != NULL && skip_culling[i]) {
-            should_draw = true;
-        } else if (visibility != NULL && visibility[i]) {
-            should_draw = true;
-        } else if (visibility == NULL && is_entity_in_frustum(&entity_array[i], camera.position, camera.target, CAM_DEFAULT_FOV)) {
-            should_draw = true;
+// Visible entities go to the render queue, which does the depth sort
+static void queue_visible_entities(Entity *entity_array, int count, bool *visibility) {
+    for (int i = 0; i < count; i++) {
+        if (visibility[i]) {
+            render_queue_add(&entity_array[i], 0);
         } else {
             culled_count++;
         }
-
-        if (should_draw) {
-            float dx = entity_array[i].position.v[0] - camera.position.v[0];
-            float dz = entity_array[i].position.v[2] - camera.position.v[2];
-            sorted_indices[visible_count].index = i;
-            sorted_indices[visible_count].distance_sq = dx * dx + dz * dz;
-            visible_count++;
-        }
-    }
-
-    if (visible_count > 1) {
-        qsort(sorted_indices, visible_count, sizeof(EntityDistance), compare_distance);
     }
+}
 
-    for (int i = 0; i < visible_count; i++) {
-        draw_entity(&entity_array[sorted_indices[i].index]);
+// Geometry that never changes topology replays a pre-recorded block
+static void queue_main_entity(int id) {
+    switch (id) {
+        case ENTITY_STATION:
+            render_queue_add(&entities[id], RQ_CACHED | RQ_NO_ZWRITE);  // Prevent self Z-fighting
+            break;
+        case ENTITY_STATION_V:
+        case ENTITY_LOADER:
+        case ENTITY_LOADER_VERT:
+        case ENTITY_WALL:
+            render_queue_add(&entities[id], RQ_CACHED);
+            break;
+        default:
+            render_queue_add(&entities[id], 0);
+            break;
     }
 }
 
@@ -309,7 +205,7 @@ static void init_subsystems(void) {
     debug_init_usblog();
     asset_init_compression(2);
     dfs_init(DFS_DEFAULT_LOCATION);
-    display_init(RESOLUTION_320x240, DEPTH_16_BPP, 3, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
+    display_init(RESOLUTION_320x240, DEPTH_16_BPP, FB_COUNT, GAMMA_NONE, FILTERS_RESAMPLE_ANTIALIAS);
 
     tv_type_t tv = get_tv_type();
     game.is_pal_system = (tv == TV_PAL);
@@ -456,13 +352,12 @@ static void render_background(sprite_t *background, float cam_yaw) {
 // Gauge Drawing Helpers
 // =============================================================================
 
-// Build a string of slash marks based on percentage (2 slashes per 10%)
-static void build_gauge_slashes(char *buffer, float percent) {
+// Number of slash marks for a percentage (1 slash per 5%, rounded up)
+static int gauge_slash_count(float percent) {
     // Clamp percent
     if (percent > 1.0f) percent = 1.0f;
     if (percent < 0.0f) percent = 0.0f;
 
-    // Calculate slash count: 2 slashes per 10%, round up for partial
     // 1-5% = 1, 6-10% = 2, 11-15% = 3, etc.
     int slash_count = 0;
     if (percent > 0.0f) {
@@ -470,12 +365,56 @@ static void build_gauge_slashes(char *buffer, float percent) {
         if (slash_count > 20) slash_count = 20;
         if (slash_count < 1 && percent > 0.0f) slash_count = 1;
     }
+    return slash_count;
+}
 
-    // Fill buffer with slashes
-    for (int i = 0; i < slash_count; i++) {
-        buffer[i] = '/';
+// =============================================================================
+// HUD Text Cache
+// =============================================================================
+// Each widget keeps its paragraph layout and only rebuilds it when the value
+// it shows changes. Drawing a cached layout skips parsing and glyph layout.
+
+#define GAUGE_SLASHES "////////////////////"  // 20 = full gauge
+
+static const rdpq_textparms_t gauge_parms = {
+    .width = 280, .height = 40,
+    .align = ALIGN_LEFT, .valign = VALIGN_BOTTOM,
+    .char_spacing = 0
+};
+static const rdpq_textparms_t resource_parms = {
+    .width = 280, .height = 40,
+    .align = ALIGN_LEFT, .valign = VALIGN_BOTTOM,
+    .char_spacing = 1
+};
+static const rdpq_textparms_t message_parms = {
+    .width = 280, .height = 40,
+    .align = ALIGN_CENTER, .valign = VALIGN_TOP,
+    .char_spacing = 1
+};
+static const rdpq_textparms_t counter_parms = {.char_spacing = 1};
+
+static CachedText hud_fuel_gauge;
+static CachedText hud_health_gauge;
+static CachedText hud_resource_percent;
+static CachedText hud_timer;                  // "M:SS", keyed on whole seconds
+static CachedText hud_timer_hundredths[100];  // ".00" - ".99", built on first use
+static CachedText hud_credits;
+static CachedText hud_status_message;         // Keyed on game.status_message_id
+static CachedText hud_low_fuel;
+static CachedText hud_need_repair;
+
+static void free_hud_cache(void) {
+    cached_text_free(&hud_fuel_gauge);
+    cached_text_free(&hud_health_gauge);
+    cached_text_free(&hud_resource_percent);
+    cached_text_free(&hud_timer);
+    for (int i = 0; i < 100; i++) {
+        cached_text_free(&hud_timer_hundredths[i]);
     }
-    buffer[slash_count] = '\0';
+    cached_text_free(&hud_credits);
+    cached_text_free(&hud_status_message);
+    cached_text_free(&hud_low_fuel);
+    cached_text_free(&hud_need_repair);
 }
 
 static void draw_cursor_fuel_bar(void) {
@@ -485,9 +424,9 @@ static void draw_cursor_fuel_bar(void) {
 
     if (fuel_percent <= 0.0f) return;
 
-    // Build slash string based on fuel level
-    char slashes[32];
-    build_gauge_slashes(slashes, fuel_percent);
+    int slash_count = gauge_slash_count(fuel_percent);
+    cached_text_update(&hud_fuel_gauge, slash_count, &gauge_parms, FONT_CUSTOM,
+                       "%.*s", slash_count, GAUGE_SLASHES);
 
     int x = 23;  // Offset from health bar on X axis (moved 15px left)
     int y = SCREEN_HEIGHT - 49;
@@ -497,20 +436,8 @@ static void draw_cursor_fuel_bar(void) {
     rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_FUEL_BAR});
 
     // Draw slashes twice offset by 1 pixel for thickness
-    rdpq_text_printf(
-        &(rdpq_textparms_t){
-            .width = 280, .height = 40,
-            .align = ALIGN_LEFT, .valign = VALIGN_BOTTOM,
-            .char_spacing = 0
-        },
-        FONT_CUSTOM, x, y, "%s", slashes);
-    rdpq_text_printf(
-        &(rdpq_textparms_t){
-            .width = 280, .height = 40,
-            .align = ALIGN_LEFT, .valign = VALIGN_BOTTOM,
-            .char_spacing = 0
-        },
-        FONT_CUSTOM, x + 1, y, "%s", slashes);
+    cached_text_draw(&hud_fuel_gauge, x, y);
+    cached_text_draw(&hud_fuel_gauge, x + 1, y);
 }
 
 static void draw_entity_health_bar(Entity *entity, float max_value, int y_offset, int is_cursor) {
@@ -522,9 +449,9 @@ static void draw_entity_health_bar(Entity *entity, float max_value, int y_offset
 
     if (health_percent <= 0.0f) return;
 
-    // Build slash string based on health level
-    char slashes[32];
-    build_gauge_slashes(slashes, health_percent);
+    int slash_count = gauge_slash_count(health_percent);
+    cached_text_update(&hud_health_gauge, slash_count, &gauge_parms, FONT_CUSTOM,
+                       "%.*s", slash_count, GAUGE_SLASHES);
 
     int x = 20;  // Moved 15px left
     int y = is_cursor ? (SCREEN_HEIGHT - 51) : (10 + y_offset - 25);
@@ -534,20 +461,8 @@ static void draw_entity_health_bar(Entity *entity, float max_value, int y_offset
     rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_HEALTH});
 
     // Draw slashes twice offset by 1 pixel for thickness
-    rdpq_text_printf(
-        &(rdpq_textparms_t){
-            .width = 280, .height = 40,
-            .align = ALIGN_LEFT, .valign = VALIGN_BOTTOM,
-            .char_spacing = 0
-        },
-        FONT_CUSTOM, x, y, "%s", slashes);
-    rdpq_text_printf(
-        &(rdpq_textparms_t){
-            .width = 280, .height = 40,
-            .align = ALIGN_LEFT, .valign = VALIGN_BOTTOM,
-            .char_spacing = 0
-        },
-        FONT_CUSTOM, x + 1, y, "%s", slashes);
+    cached_text_draw(&hud_health_gauge, x, y);
+    cached_text_draw(&hud_health_gauge, x + 1, y);
 }
 
 
@@ -569,19 +484,10 @@ static void draw_entity_resource_bar(int resource_val, float max_value, int y_of
     rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
 
     if (!show_triangle) {
+        int percent = (int)(resource_percent * 100);
+        cached_text_update(&hud_resource_percent, percent, &resource_parms, FONT_CUSTOM, "%d%%", percent);
         rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_RESOURCE});
-            rdpq_text_printf(
-                &(rdpq_textparms_t){
-                    .width = 280,
-                    .height = 40,
-                    .align = ALIGN_LEFT,
-                    .valign = VALIGN_BOTTOM,
-                    .char_spacing = 1
-                },
-                FONT_CUSTOM,
-                20 ,  // X: moved 15px left
-                y - 24,
-                 "%d%s", (int)(resource_percent * 100), "%" );
+        cached_text_draw(&hud_resource_percent, 20, y - 24);  // X: moved 15px left
     }
 
     int icon_x = x - 20;
@@ -726,25 +632,24 @@ static void draw_game_timer(void) {
     int y = 20;
 
 
-    // Draw timer
+    // Draw timer - minutes:seconds changes once a second, the hundredths
+    // come from a table so neither is laid out per frame
+    if (hundredths < 0) hundredths = 0;
+    if (hundredths > 99) hundredths = 99;
+    cached_text_update(&hud_timer, total_seconds, &counter_parms, FONT_CUSTOM, "%d:%02d", minutes, seconds);
+    cached_text_update(&hud_timer_hundredths[hundredths], hundredths, &counter_parms, FONT_CUSTOM, ".%02d", hundredths);
+    cached_text_update(&hud_credits, game.accumulated_credits, &counter_parms, FONT_CUSTOM, "c: %d", game.accumulated_credits);
+
+    float timer_x = display_get_width() - 64;
     rdpq_sync_pipe();
     rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_ASTEROID});
-
-    rdpq_text_printf(
-        &(rdpq_textparms_t){.char_spacing = 1},
-        FONT_CUSTOM,
-        display_get_width() - 64,
-        display_get_height() - 15,
-        "%d:%02d.%02d", minutes, seconds, hundredths);
-
+    cached_text_draw(&hud_timer, timer_x, display_get_height() - 15);
+    cached_text_draw(&hud_timer_hundredths[hundredths],
+                     timer_x + hud_timer.layout->bbox.x1 + counter_parms.char_spacing,
+                     display_get_height() - 15);
 
     rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_HEALTH});
-    rdpq_text_printf(
-        &(rdpq_textparms_t){.char_spacing = 1},
-        FONT_CUSTOM,
-        display_get_width() - 64,
-        display_get_height() - 25,
-        "c: %d", game.accumulated_credits);
+    cached_text_draw(&hud_credits, timer_x, display_get_height() - 25);
 
     float fuel_percent = game.ship_fuel / CURSOR_MAX_FUEL;
     float health_percent = cursor_entity->value / CURSOR_MAX_HEALTH;
@@ -752,20 +657,10 @@ static void draw_game_timer(void) {
     // Show status message if timer active (other messages like "Credits +X")
     if (game.status_message_timer > 0.0f) {
         rdpq_sync_pipe();
+        cached_text_update(&hud_status_message, game.status_message_id, &message_parms, FONT_CUSTOM,
+                           "%s", game.status_message);
         rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_ASTEROID });
-        rdpq_text_printf(
-            &(rdpq_textparms_t){
-                .width = 280,
-                .height = 40,
-                .align = ALIGN_CENTER,
-                .valign = VALIGN_TOP,
-                .char_spacing = 1
-            },
-            FONT_CUSTOM,
-            display_get_width() / 2 - 140,
-            10,
-            "%s", game.status_message
-        );
+        cached_text_draw(&hud_status_message, display_get_width() / 2 - 140, 10);
     } else {
         // Only show low fuel/health warnings when no other message is showing
         bool low_fuel = fuel_percent < 0.3f;
@@ -784,35 +679,13 @@ static void draw_game_timer(void) {
             if ((int)(game.blink_timer / 10) % 2 == 0) {
                 rdpq_sync_pipe();
                 if (show_fuel_warning) {
+                    cached_text_update(&hud_low_fuel, 0, &message_parms, FONT_CUSTOM, "--LOW FUEL--");
                     rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_FUEL_BAR});
-                    rdpq_text_printf(
-                        &(rdpq_textparms_t){
-                            .width = 280,
-                            .height = 40,
-                            .align = ALIGN_CENTER,
-                            .valign = VALIGN_TOP,
-                            .char_spacing = 1
-                        },
-                        FONT_CUSTOM,
-                        display_get_width() / 2 - 140,
-                        10,
-                        "%s", "--LOW FUEL--"
-                    );
+                    cached_text_draw(&hud_low_fuel, display_get_width() / 2 - 140, 10);
                 } else {
+                    cached_text_update(&hud_need_repair, 0, &message_parms, FONT_CUSTOM, "--NEED REPAIR--");
                     rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = COLOR_HEALTH});
-                    rdpq_text_printf(
-                        &(rdpq_textparms_t){
-                            .width = 280,
-                            .height = 40,
-                            .align = ALIGN_CENTER,
-                            .valign = VALIGN_TOP,
-                            .char_spacing = 1
-                        },
-                        FONT_CUSTOM,
-                        display_get_width() / 2 - 140,
-                        10,
-                        "%s", "--NEED REPAIR--"
-                    );
+                    cached_text_draw(&hud_need_repair, display_get_width() / 2 - 140, 10);
                 }
             }
         }
@@ -860,14 +733,289 @@ static void update_ship_fuel(float delta_time, bool accelerating) {
     }
 }
 
+// =============================================================================
+// Fixed-Step Simulation
+// =============================================================================
+
+// One gameplay tick of FIXED_TIMESTEP seconds
+static void simulate_step(float delta_time) {
+    // Keep the previous tick for render interpolation
+    save_entity_states(entities, ENTITY_COUNT);
+    save_entity_states(resources, RESOURCE_COUNT);
+    for (int i = 0; i < entity_pool_dynamic_count(); i++) {
+        save_entity_states(entity_pool_dynamic(i), 1);
+    }
+
+    PROFILE_BEGIN(PROF_CURSOR);
+    update_cursor_movement(delta_time, cursor_entity, jets_entity);
+    PROFILE_END(PROF_CURSOR);
+
+    PROFILE_BEGIN(PROF_WORLD);
+    update_screen_shake(delta_time);
+    update_tile_visibility(&entities[ENTITY_TILE]);
+    update_boundary_wall(&entities[ENTITY_WALL], game.cursor_position, delta_time);
+
+    check_tile_following_status(&entities[ENTITY_DRONE]);
+
+    // Tile scale animation
+    if (game.drone_moving_to_station) {
+        game.tile_scale_multiplier += delta_time * 3.0f;
+        if (game.tile_scale_multiplier >= 4.0f) {
+            game.tile_scale_multiplier = 1.0f;
+        }
+    } else if (game.move_drone || game.tile_following_resource >= 0) {
+        game.tile_scale_multiplier += delta_time * 1.25f;
+        if (game.tile_scale_multiplier >= 1.0f) {
+            game.tile_scale_multiplier = 0.25f;
+        }
+    } else {
+        game.tile_scale_multiplier = 0.25f;
+    }
+
+    // Drone movement
+    if (game.drone_heal) {
+        // Continuously update target to follow cursor in heal mode
+        game.drone_target_position.v[0] = game.cursor_position.v[0];
+        game.drone_target_position.v[1] = game.cursor_position.v[1];
+        game.drone_target_position.v[2] = game.cursor_position.v[2];
+        game.move_drone = true;
+    }
+    if (game.move_drone) {
+        move_drone_to_target(&entities[ENTITY_DRONE], delta_time, false);
+    }
+
+    // Update world
+    update_asteroids_optimized(&asteroids, delta_time);
+    update_resources(resources, RESOURCE_COUNT, delta_time);
+    build_collision_grids(&asteroids, resources, RESOURCE_COUNT);
+    update_particles(delta_time);
+
+    // Rotate station slowly
+    entities[ENTITY_STATION].rotation.v[1] += delta_time * 0.1f;
+    if (entities[ENTITY_STATION].rotation.v[1] > TWO_PI) {
+        entities[ENTITY_STATION].rotation.v[1] -= TWO_PI;
+    }
+    entities[ENTITY_STATION_V].rotation.v[0] += delta_time * 0.1f;
+    if (entities[ENTITY_STATION_V].rotation.v[0] > TWO_PI) {
+        entities[ENTITY_STATION_V].rotation.v[0] -= TWO_PI;
+    }
+
+
+
+
+
+
+    float roation_speed = 0.9f;
+    // game.hauled_resources, rotate the loader faster for 2 secons
+    if (game.hauled_resources) {
+        if (game.hauled_resources_timer < 1.0f) {
+            roation_speed = 0.9f + (2.7f * (game.hauled_resources_timer / 1.0f));
+        } else {
+            roation_speed = 3.6f;
+        }
+        game.hauled_resources_timer += delta_time;
+        if (game.hauled_resources_timer >= 4.0f) {
+            game.hauled_resources = false;
+            game.hauled_resources_timer = 0.0f;
+        }
+
+        // Spawn celebration particles around the loader
+        spawn_loader_sparks(entities[ENTITY_LOADER].position);
+    }
+    entities[ENTITY_LOADER].rotation.v[1] -= delta_time * roation_speed;
+    if (entities[ENTITY_LOADER].rotation.v[1] < 0.0f) {
+        entities[ENTITY_LOADER].rotation.v[1] += TWO_PI;
+    }
+
+    entities[ENTITY_LOADER_VERT].rotation.v[0] += delta_time * roation_speed;
+    if (entities[ENTITY_LOADER_VERT].rotation.v[0] < 0.0f) {
+        entities[ENTITY_LOADER_VERT].rotation.v[0] += TWO_PI;
+    }
+    PROFILE_END(PROF_WORLD);
+
+    // Reset colors
+    reset_resource_colors(resources, RESOURCE_COUNT);
+
+    // Collision detection
+    PROFILE_BEGIN(PROF_COLLISION);
+
+    // Asteroid contacts at ~30Hz, swept over the whole interval since the last check
+    float asteroid_elapsed = 0.0f;
+    game.collision_timer += delta_time;
+    if (game.collision_timer >= 0.033f) {
+        asteroid_elapsed = game.collision_timer;
+        game.collision_timer = 0.0f;
+    }
+
+    CollisionScene scene = {
+        .cursor = &entities[ENTITY_CURSOR],
+        .drone = &entities[ENTITY_DRONE],
+        .tile = &entities[ENTITY_TILE],
+        .asteroids = &asteroids,
+        .asteroid_visible = asteroid_visible,
+        .resources = resources,
+        .resource_count = RESOURCE_COUNT,
+    };
+    collect_contacts(&scene, asteroid_elapsed);
+    handle_resource_contacts(&scene, delta_time);
+
+    check_cursor_station_collision(&entities[ENTITY_CURSOR], &entities[ENTITY_STATION]);
+    check_drone_station_collisions(&entities[ENTITY_DRONE], &entities[ENTITY_STATION], 1);
+
+    if (game.drone_heal) {
+        check_drone_cursor_collisions(&entities[ENTITY_DRONE], &entities[ENTITY_CURSOR], 1);
+    }
+
+    if (cursor_entity->value > 0 && game.ship_fuel > 0) {
+        game.disabled_controls = false;
+    } else  {
+        game.disabled_controls = true;
+    }
+
+    handle_asteroid_contacts(&scene, asteroid_elapsed);
+    check_loader_asteroid_collisions_opt(&entities[ENTITY_LOADER], &asteroids);
+    PROFILE_END(PROF_COLLISION);
+
+    // Update deflection timer
+    update_deflect_timer(delta_time);
+
+    // Update rumble timer
+    update_rumble(delta_time);
+
+    // Update death timer (when cursor health = 0)
+    if (entities[ENTITY_CURSOR].value <= 0 || game.ship_fuel <= 0) {
+        if (!game.death_timer_active) {
+            game.death_timer_active = true;
+            game.death_timer = 0.0f;
+        }
+
+        game.death_timer += delta_time;
+        if (game.death_timer >= 10.0f) {
+            // 10 seconds reached - show game over menu
+            game.game_over = true;
+            game.game_over_pause = true;
+            game.menu_selection = 0;  // Reset menu selection for Continue/Quit
+            game.death_timer = 10.0f;
+            stop_rumble();
+            // Don't set reset here - let the menu handle it
+        }
+    } else {
+        // Reset if health restored
+        game.death_timer_active = false;
+        game.death_timer = 0.0f;
+    }
+
+
+    update_color_flashes(delta_time);
+    update_ship_fuel(delta_time, game.ship_acceleration);
+    update_difficulty(delta_time);
+}
+
 // =============================================================================
 // Frame Rendering
 // =============================================================================
 
-static void render_frame(T3DViewport *viewport, sprite_t *background, float cam_yaw, float delta_time) {
-    culled_count = 0;
-    rdpq_attach(display_get(), display_get_zbuf());
+// The ring sits on the cursor while deflecting; it has no transform of its own
+static void build_deflect_ring_matrix(float alpha) {
+    float deflect_scale = DEFLECT_RADIUS / 15.0f;
+    T3DVec3 ring_pos, ring_rot;
+    get_entity_interpolated(&entities[ENTITY_CURSOR], alpha, &ring_pos, &ring_rot);
+
+    t3d_mat4fp_from_srt_euler(get_entity_matrix(&entities[ENTITY_DEFLECT_RING]),
+        (float[3]){deflect_scale, 0.5f, deflect_scale},
+        (float[3]){0, 0, 0},
+        (float[3]){ring_pos.v[0], ring_pos.v[1] + 1.0f, ring_pos.v[2]});
+}
+
+// Fill this frame's matrix slots - the only place entity matrices are built,
+// including the per-draw scale overrides. Runs in every state (including
+// pause/countdown) since the other slots may hold older transforms.
+// Transforms are interpolated between the last two sim ticks by alpha;
+// build_entity_matrix() skips slots that already hold a stationary transform.
+static void build_frame_matrices(float alpha) {
+    for (int i = 0; i < ENTITY_COUNT; i++) {
+        Entity *entity = &entities[i];
+        float scale[3] = {entity->scale, entity->scale, entity->scale};
+
+        if (i == ENTITY_DEFLECT_RING) {
+            if (game.deflect_active) build_deflect_ring_matrix(alpha);
+            continue;
+        }
+        if (i == ENTITY_CURSOR) {
+            // Distance-based scale
+            scale[0] = scale[1] = scale[2] = entity->scale * game.cursor_scale_multiplier;
+        } else if (i == ENTITY_TILE && tile_scale_animated()) {
+            scale[0] *= game.tile_scale_multiplier;
+            scale[2] *= game.tile_scale_multiplier;
+        }
+        build_entity_matrix(entity, alpha, scale);
+    }
+
+    // Note: Asteroid matrices are handled in draw_asteroids_optimized()
+    for (int i = 0; i < RESOURCE_COUNT; i++) {
+        if (resource_visible[i]) {
+            update_entity_matrix_interpolated(&resources[i], alpha);
+        }
+    }
+    for (int i = 0; i < entity_pool_dynamic_count(); i++) {
+        if (dynamic_visible[i]) {
+            update_entity_matrix_interpolated(entity_pool_dynamic(i), alpha);
+        }
+    }
+}
+
+// =============================================================================
+// Freeze Frame (pause / game over)
+// =============================================================================
+// The first paused frame renders the scene into freeze_surface and dims it;
+// later paused frames just blit it under the menu instead of redrawing 3D.
+
+static surface_t freeze_surface;
+static bool freeze_surface_allocated = false;
+static bool freeze_frame_valid = false;
+
+// (Re)allocates to match the framebuffer, which changes with the hi-res toggle
+static surface_t *get_freeze_surface(surface_t *framebuffer) {
+    if (freeze_surface_allocated &&
+        (freeze_surface.width != framebuffer->width || freeze_surface.height != framebuffer->height)) {
+        rspq_wait();  // Earlier frames may still be blitting from it
+        surface_free(&freeze_surface);
+        freeze_surface_allocated = false;
+    }
+    if (!freeze_surface_allocated) {
+        freeze_surface = surface_alloc(surface_get_format(framebuffer), framebuffer->width, framebuffer->height);
+        freeze_surface_allocated = true;
+    }
+    return &freeze_surface;
+}
+
+static void dim_freeze_surface(void) {
+    if (PAUSE_DIM_ALPHA == 0) return;
+    rdpq_set_mode_standard();
+    rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
+    rdpq_mode_blender(RDPQ_BLENDER_MULTIPLY);
+    rdpq_set_prim_color(RGBA32(0, 0, 0, PAUSE_DIM_ALPHA));
+    rdpq_fill_rectangle(0, 0, freeze_surface.width, freeze_surface.height);
+}
 
+static void blit_freeze_frame(void) {
+    rdpq_set_mode_copy(false);
+    rdpq_tex_blit(&freeze_surface, 0, 0, NULL);
+    rdpq_set_mode_standard();  // Menus draw on top expecting standard mode
+}
+
+static void free_freeze_surface(void) {
+    if (freeze_surface_allocated) {
+        surface_free(&freeze_surface);
+        freeze_surface_allocated = false;
+    }
+    freeze_frame_valid = false;
+}
+
+// 3D scene plus in-game HUD, into whatever surface is attached.
+// force_particles bypasses the ~30Hz particle gate (the freeze capture is one frame).
+static void render_scene(T3DViewport *viewport, sprite_t *background, float cam_yaw, float delta_time,
+                         bool force_particles) {
     if (game.render_background_enabled) {
         render_background(background, cam_yaw);
     } else {
@@ -891,30 +1039,17 @@ static void render_frame(T3DViewport *viewport, sprite_t *background, float cam_
     entity_skip_culling[ENTITY_CURSOR] = true;
     entity_skip_culling[ENTITY_STATION] = true;
 
-    // Draw main entities
+    // Queue main entities
+    render_queue_begin();
     for (int i = 0; i < ENTITY_COUNT; i++) {
-        if (i == ENTITY_STATION || i == ENTITY_STATION_V) continue;
-
-        // Cursor with distance-based scale
-        if (i == ENTITY_CURSOR && game.cursor_scale_multiplier != 1.0f) {
-            float original_scale = entities[i].scale;
-            T3DMat4 temp_mat;
-            t3d_mat4_from_srt_euler(&temp_mat,
-                (float[3]){original_scale * game.cursor_scale_multiplier,
-                           original_scale * game.cursor_scale_multiplier,
-                           original_scale * game.cursor_scale_multiplier},
-                (float[3]){entities[i].rotation.v[0], entities[i].rotation.v[1], entities[i].rotation.v[2]},
-                entities[i].position.v);
-            t3d_mat4_to_fixed(entities[i].matrix, &temp_mat);
-            draw_entity(&entities[i]);
-            entities[i].scale = original_scale;
-            continue;
-        }
 
-        // Tile with animated scale
-        if (i == ENTITY_TILE && (game.drone_moving_to_station || game.move_drone || game.tile_following_resource >= 0)) {
+        // Tile while animating (scale is applied in build_frame_matrices)
+        if (i == ENTITY_TILE && tile_scale_animated()) {
+            if (!entity_visible[i]) {
+                culled_count++;
+                continue;
+            }
             color_t original_color = entities[i].color;
-            float original_scale = entities[i].scale;
 
             if (game.drone_moving_to_station) {
                 entities[i].color = RGBA32(255, 0, 255, 255);
@@ -924,71 +1059,51 @@ static void render_frame(T3DViewport *viewport, sprite_t *background, float cam_
                 entities[i].color = COLOR_TILE;
             }
 
-            T3DMat4 temp_mat;
-            t3d_mat4_from_srt_euler(&temp_mat,
-                (float[3]){original_scale * game.tile_scale_multiplier, original_scale, original_scale * game.tile_scale_multiplier},
-                (float[3]){entities[i].rotation.v[0], entities[i].rotation.v[1], entities[i].rotation.v[2]},
-                entities[i].position.v);
-            t3d_mat4_to_fixed(entities[i].matrix, &temp_mat);
-            draw_entity(&entities[i]);
+            render_queue_add(&entities[i], 0);  // Color is captured here, safe to restore
             entities[i].color = original_color;
-            entities[i].scale = original_scale;
             continue;
         }
 
         // Deflection ring - only draw when active
         if (i == ENTITY_DEFLECT_RING) {
             if (game.deflect_active) {
-                float deflect_scale = DEFLECT_RADIUS / 15.0f;
-
-                T3DMat4 deflect_mat;
-                t3d_mat4_from_srt_euler(&deflect_mat,
-                    (float[3]){deflect_scale, 0.5f, deflect_scale},
-                    (float[3]){0, 0, 0},
-                    (float[3]){entities[ENTITY_CURSOR].position.v[0],
-                            entities[ENTITY_CURSOR].position.v[1] + 1.0f,
-                            entities[ENTITY_CURSOR].position.v[2]});
-                t3d_mat4_to_fixed(entities[ENTITY_DEFLECT_RING].matrix, &deflect_mat);
                 //increase alpha for fade-in effect
                 uint8_t alpha = (uint8_t)(200.0f * (game.deflect_timer / DEFLECT_DURATION));
                 if (alpha > 200) alpha = 200;
                 entities[ENTITY_DEFLECT_RING].color = RGBA32(138, 0, 196, alpha);
 
-                draw_entity(&entities[ENTITY_DEFLECT_RING]);
+                render_queue_add(&entities[ENTITY_DEFLECT_RING], 0);
 
             }
             continue;
         }
 
         if (entity_skip_culling[i]) {
-            draw_entity(&entities[i]);
-        } else if (is_entity_in_frustum(&entities[i], camera.position, camera.target, CAM_DEFAULT_FOV)) {
-            draw_entity(&entities[i]);
+            queue_main_entity(i);
+        } else if (entity_visible[i]) {
+            queue_main_entity(i);
         } else {
             culled_count++;
         }
     }
 
-    // Draw asteroids (optimized with matrix pool) and resources - skip during countdown
-    if (game.state != STATE_COUNTDOWN) {
-        draw_asteroids_optimized(asteroids, asteroid_visible, asteroid_distance_sq, ASTEROID_COUNT);
+    queue_visible_entities(resources, RESOURCE_COUNT, resource_visible);
+    for (int i = 0; i < entity_pool_dynamic_count(); i++) {
+        queue_visible_entities(entity_pool_dynamic(i), 1, &dynamic_visible[i]);
     }
-    draw_entities_sorted(resources, RESOURCE_COUNT, NULL, resource_visible);
-
-    // Draw station - disable Z-write to prevent self Z-fighting
-    rdpq_mode_zbuf(true, false);  // Z-read on, Z-write off
-    draw_entity(&entities[ENTITY_STATION]);
-    rdpq_mode_zbuf(true, true);   // Restore Z-write
-    rdpq_sync_pipe();
 
-    rdpq_mode_zbuf(true, false);  // Z-read on, Z-write off
-    draw_entity(&entities[ENTITY_STATION_V]);
-    rdpq_mode_zbuf(true, true);   // Restore Z-write
-    rdpq_sync_pipe();
+    // Asteroid batch first (sorted itself, skipped during countdown) so it
+    // lands before the opaque pass's no-Z-write items, then translucent
+    // geometry over the finished depth buffer
+    if (game.state != STATE_COUNTDOWN) {
+        draw_asteroids_optimized(&asteroids, asteroid_visible, asteroid_distance_sq, game.render_alpha);
+    }
+    render_queue_submit(RENDER_PASS_OPAQUE);
+    render_queue_submit(RENDER_PASS_TRANSLUCENT);
 
     // Render particles at ~30Hz
     game.particle_render_timer += delta_time;
-    if (game.particle_render_timer >= 0.033f) {
+    if (force_particles || game.particle_render_timer >= 0.033f) {
         draw_particles(viewport);
         game.particle_render_timer = 0.0f;
     }
@@ -1060,6 +1175,37 @@ static void render_frame(T3DViewport *viewport, sprite_t *background, float cam_
             display_get_height() / 2 - 20,
                "GO!");
     }
+}
+
+static void render_frame(T3DViewport *viewport, sprite_t *background, float cam_yaw, float delta_time) {
+    culled_count = 0;
+
+    // With frames pipelined, this is where the CPU waits on the RCP
+    PROFILE_BEGIN(PROF_RCP_WAIT);
+    surface_t *framebuffer = display_get();
+    PROFILE_END(PROF_RCP_WAIT);
+
+    PROFILE_BEGIN(PROF_RENDER);
+    bool frozen = (game.state == STATE_PAUSED || game.game_over);
+    if (frozen && freeze_frame_valid &&
+        freeze_surface.width == framebuffer->width && freeze_surface.height == framebuffer->height) {
+        rdpq_attach(framebuffer, NULL);
+        blit_freeze_frame();
+    } else if (frozen) {
+        // Nothing simulates while frozen, so this matches the last gameplay frame
+        rdpq_attach(get_freeze_surface(framebuffer), display_get_zbuf());
+        render_scene(viewport, background, cam_yaw, delta_time, true);
+        dim_freeze_surface();
+        rdpq_detach();
+
+        rdpq_attach(framebuffer, NULL);
+        blit_freeze_frame();
+        freeze_frame_valid = true;
+    } else {
+        rdpq_attach(framebuffer, display_get_zbuf());
+        render_scene(viewport, background, cam_yaw, delta_time, false);
+        freeze_frame_valid = false;
+    }
 
     if (game.render_debug) {
         render_debug_ui(game.cursor_position, entities, resources, RESOURCE_COUNT, culled_count,
@@ -1077,6 +1223,7 @@ static void render_frame(T3DViewport *viewport, sprite_t *background, float cam_
     }
 
     rdpq_detach_show();
+    PROFILE_END(PROF_RENDER);
 }
 
 // =============================================================================
@@ -1085,7 +1232,7 @@ static void render_frame(T3DViewport *viewport, sprite_t *background, float cam_
 
 int main(void) {
     init_subsystems();
-    T3DViewport viewport = t3d_viewport_create();
+    T3DViewport viewport = t3d_viewport_create_buffered(FB_COUNT);
 
     // Load sprites
     sprite_t *background = sprite_load("rom:/bg1024v2.sprite");
@@ -1098,35 +1245,42 @@ int main(void) {
 
 
     // Create entities
-    entities[ENTITY_STATION] = create_entity("rom:/stationring2.t3dm", (T3DVec3){{0, DEFAULT_HEIGHT, 0}},
+    entity_pool_init(ENTITY_COUNT + RESOURCE_COUNT);
+    entities = entity_pool_slot(0);
+    resources = entity_pool_slot(ENTITY_COUNT);
+
+    init_entity(&entities[ENTITY_STATION], "rom:/stationring2.t3dm", (T3DVec3){{0, DEFAULT_HEIGHT, 0}},
                                               1.0f, COLOR_STATION, DRAW_TEXTURED_LIT, 30.0f);
-    entities[ENTITY_STATION_V] = create_entity("rom:/ringvert.t3dm", (T3DVec3){{0, 1, 0}},
+    init_entity(&entities[ENTITY_STATION_V], "rom:/ringvert.t3dm", (T3DVec3){{0, 1, 0}},
                                            1.0f, COLOR_MAP, DRAW_SHADED, 0.0f);
 
-    entities[ENTITY_CURSOR] = create_entity("rom:/cursor3.t3dm", game.cursor_position,
+    init_entity(&entities[ENTITY_CURSOR], "rom:/cursor3.t3dm", game.cursor_position,
                                              0.562605f, COLOR_CURSOR, DRAW_SHADED, 10.0f);
     entities[ENTITY_CURSOR].value = CURSOR_MAX_HEALTH;
 
-    entities[ENTITY_JETS] = create_entity("rom:/jets.t3dm", game.cursor_position,
+    init_entity(&entities[ENTITY_JETS], "rom:/jets.t3dm", game.cursor_position,
                                              0.562605f, RGBA32(138, 0, 196, 0), DRAW_SHADED, 10.0f);
 
-    entities[ENTITY_DRONE] = create_entity("rom:/dronenew.t3dm", (T3DVec3){{60.0f, DEFAULT_HEIGHT, 69.0f}},
+    init_entity(&entities[ENTITY_DRONE], "rom:/dronenew.t3dm", (T3DVec3){{60.0f, DEFAULT_HEIGHT, 69.0f}},
                                             0.55f, COLOR_DRONE, DRAW_SHADED, 30.0f);
-    entities[ENTITY_TILE] = create_entity("rom:/tile2.t3dm", (T3DVec3){{0, 1000, 0}},
+    init_entity(&entities[ENTITY_TILE], "rom:/tile2.t3dm", (T3DVec3){{0, 1000, 0}},
                                            1.0f, COLOR_TILE, DRAW_SHADED, 10.0f);
-    entities[ENTITY_LOADER] = create_entity("rom:/loader2.t3dm", (T3DVec3){{0, 1, 0}},
+    init_entity(&entities[ENTITY_LOADER], "rom:/loader2.t3dm", (T3DVec3){{0, 1, 0}},
                                            1.0f,  RGBA32(255, 237, 41, 175), DRAW_SHADED, 50.0f);
 
-    entities[ENTITY_LOADER_VERT] = create_entity("rom:/loader_vert2.t3dm", (T3DVec3){{0, 1, 0}},
+    init_entity(&entities[ENTITY_LOADER_VERT], "rom:/loader_vert2.t3dm", (T3DVec3){{0, 1, 0}},
                                            1.0f,  RGBA32(255, 237, 41, 175), DRAW_SHADED, 50.0f);
 
-    entities[ENTITY_DEFLECT_RING] = create_entity("rom:/sphere.t3dm", (T3DVec3){{0, 1000, 0}},
+    init_entity(&entities[ENTITY_DEFLECT_RING], "rom:/sphere.t3dm", (T3DVec3){{0, 1000, 0}},
                                        1.0f, RGBA32(0, 150, 255, 200), DRAW_SHADED, 0.0f);
 
-    entities[ENTITY_WALL] = create_entity("rom:/wall.t3dm", (T3DVec3){{0, 1000, 0}},
+    init_entity(&entities[ENTITY_WALL], "rom:/wall.t3dm", (T3DVec3){{0, 1000, 0}},
                                            1.0f, RGBA32(255, 237, 41, 175), DRAW_SHADED, 0.0f);
 
-    init_asteroids_optimized(asteroids, ASTEROID_COUNT);
+    // Loader hits are scheduled at asteroid spawn, so register it first
+    set_asteroid_target_circle(entities[ENTITY_LOADER].position,
+                               entities[ENTITY_LOADER].collision_radius + ASTEROID_COLLISION_RADIUS);
+    init_asteroids_optimized(&asteroids, ASTEROID_COUNT);
     init_resources(resources, RESOURCE_COUNT);
 
     cursor_entity = &entities[ENTITY_CURSOR];
@@ -1145,26 +1299,34 @@ int main(void) {
     // Play title screen music
     play_bgm("rom:/lunramtit.wav64");
 
+
     // =============================================================================
     // Main Game Loop
     // =============================================================================
 
     for (;;) {
+        // Frames are pipelined (no rspq_wait), so every RCP-visible buffer
+        // written this frame must come from the current slot
+        advance_frame_index();
+        PROFILE_FRAME_BEGIN();
+        update_audio();
+
         float delta_time = display_get_delta_time();
 
         // Clamp delta_time to prevent issues
         if (delta_time < 0.001f) delta_time = 0.001f;
         if (delta_time > 0.1f) delta_time = 0.1f;
 
+        PROFILE_BEGIN(PROF_INPUT);
         joypad_poll();
         update_input();
+        PROFILE_END(PROF_INPUT);
 
         //defaul to white font color
         rdpq_font_style(custom_font, 0, &(rdpq_fontstyle_t){.color = RGBA32(255, 255, 255, 255)});
 
         // Handle title screen
         if (game.state == STATE_TITLE) {
-            update_audio();
             static float title_cam_yaw = 0.0f;
 
             // B to quit
@@ -1176,7 +1338,6 @@ int main(void) {
 
             if (input.pressed.start) {
                 stop_bgm();
-                update_audio();
 
                 game.state = STATE_COUNTDOWN;
                 game.countdown_timer = 4.0f;
@@ -1202,10 +1363,9 @@ int main(void) {
 
                 // Reset asteroids off-screen when starting game
                 for (int i = 0; i < ASTEROID_COUNT; i++) {
-                    reset_asteroid(&asteroids[i]);
+                    reset_asteroid(&asteroids, i);
                     // Move asteroids far away so they're not visible during countdown
-                    asteroids[i].position.v[0] = 2000.0f + (i * 10.0f);
-                    asteroids[i].position.v[2] = 2000.0f + (i * 10.0f);
+                    place_asteroid(&asteroids, i, 2000.0f + (i * 10.0f), 2000.0f + (i * 10.0f));
                 }
                 // Reset camera yaw
                 game.cam_yaw = CAM_ANGLE_YAW;
@@ -1220,8 +1380,9 @@ int main(void) {
                 if (title_cam_yaw < 0.0f || !isfinite(title_cam_yaw)) title_cam_yaw = 0.0f;
             }
 
-            // Update asteroids
-            update_asteroids_optimized(asteroids, ASTEROID_COUNT, delta_time);
+            // Update asteroids (no loader collisions on the title screen)
+            update_asteroids_optimized(&asteroids, delta_time);
+            discard_asteroid_target_hits();
 
             // Rotate station for visual effect
             entities[ENTITY_STATION_V].rotation.v[0] += delta_time * 0.1f;
@@ -1233,12 +1394,9 @@ int main(void) {
             update_camera(&viewport, title_cam_yaw, delta_time, (T3DVec3){{0, 0, 0}}, false, cursor_entity);
 
             // Perform visibility/culling for asteroids
-            for (int i = 0; i < ASTEROID_COUNT; i++) {
-                float dx = asteroids[i].position.v[0] - camera.position.v[0];
-                float dz = asteroids[i].position.v[2] - camera.position.v[2];
-                asteroid_distance_sq[i] = dx * dx + dz * dz;
-                asteroid_visible[i] = (asteroid_distance_sq[i] < ASTEROID_DRAW_DISTANCE_SQ);
-            }
+            update_frustum(&viewport);
+            cull_asteroids(&asteroids, get_asteroid_model_radius(), ASTEROID_DRAW_DISTANCE_SQ,
+                           asteroid_visible, asteroid_distance_sq);
 
             // Render 3D scene
             rdpq_attach(display_get(), display_get_zbuf());
@@ -1252,20 +1410,17 @@ int main(void) {
             int light_count = 1;
             t3d_light_set_count(light_count);
 
-            // Draw asteroids
-            draw_asteroids_optimized(asteroids, asteroid_visible, asteroid_distance_sq, ASTEROID_COUNT);
-
-            // Sync before drawing station
-            rdpq_sync_pipe();
+            // Draw asteroids (title screen steps with the frame delta, nothing to interpolate)
+            draw_asteroids_optimized(&asteroids, asteroid_visible, asteroid_distance_sq, 1.0f);
 
             // Draw station entities
             update_entity_matrix(&entities[ENTITY_STATION]);
             update_entity_matrix(&entities[ENTITY_STATION_V]);
-            rdpq_mode_zbuf(true, false);  // Z-read on, Z-write off
-            draw_entity(&entities[ENTITY_STATION]);
-            rdpq_sync_pipe();
-            draw_entity(&entities[ENTITY_STATION_V]);
-            rdpq_mode_zbuf(true, true);   // Restore Z-write
+            render_queue_begin();
+            queue_main_entity(ENTITY_STATION);
+            queue_main_entity(ENTITY_STATION_V);
+            render_queue_submit(RENDER_PASS_OPAQUE);
+            render_queue_submit(RENDER_PASS_TRANSLUCENT);
 
             // Sync before switching to 2D text rendering
             rdpq_sync_pipe();
@@ -1360,7 +1515,9 @@ int main(void) {
             continue;
         }
 
+        PROFILE_BEGIN(PROF_INPUT);
         process_system_input(&viewport);
+        PROFILE_END(PROF_INPUT);
 
         // Update message queue (handles timer and cycling through queued messages)
         update_message_queue(delta_time);
@@ -1380,175 +1537,32 @@ int main(void) {
         }
 
         if (game.state == STATE_PLAYING && !game.game_over) {
-            update_cursor_movement(delta_time, cursor_entity, jets_entity);
+            // Edge-triggered input runs once per rendered frame, not per tick
+            PROFILE_BEGIN(PROF_INPUT);
             process_game_input(delta_time);
-            update_camera(&viewport, game.cam_yaw, delta_time, game.cursor_position, game.fps_mode, cursor_entity);
-            update_screen_shake(delta_time);
-            update_tile_visibility(&entities[ENTITY_TILE]);
-            update_boundary_wall(&entities[ENTITY_WALL], game.cursor_position, delta_time);
-
-            // Tile collision (only if drone not full)
-            if (!game.drone_full) {
-                check_tile_resource_collision(&entities[ENTITY_TILE], resources, RESOURCE_COUNT);
-            }
-
-            check_tile_following_status(&entities[ENTITY_DRONE]);
-
-            // Tile scale animation
-            if (game.drone_moving_to_station) {
-                game.tile_scale_multiplier += delta_time * 3.0f;
-                if (game.tile_scale_multiplier >= 4.0f) {
-                    game.tile_scale_multiplier = 1.0f;
-                }
-            } else if (game.move_drone || game.tile_following_resource >= 0) {
-                game.tile_scale_multiplier += delta_time * 1.25f;
-                if (game.tile_scale_multiplier >= 1.0f) {
-                    game.tile_scale_multiplier = 0.25f;
-                }
-            } else {
-                game.tile_scale_multiplier = 0.25f;
+            PROFILE_END(PROF_INPUT);
+
+            // Run as many fixed ticks as real time allows, capped so a slow
+            // frame can't snowball into ever more simulation work
+            game.accumulator += delta_time;
+            int substeps = 0;
+            while (game.accumulator >= FIXED_TIMESTEP && substeps < MAX_SIM_SUBSTEPS &&
+                   !game.game_over) {
+                simulate_step(FIXED_TIMESTEP);
+                game.accumulator -= FIXED_TIMESTEP;
+                substeps++;
             }
-
-            // Drone movement
-            if (game.drone_heal) {
-                // Continuously update target to follow cursor in heal mode
-                game.drone_target_position.v[0] = game.cursor_position.v[0];
-                game.drone_target_position.v[1] = game.cursor_position.v[1];
-                game.drone_target_position.v[2] = game.cursor_position.v[2];
-                game.move_drone = true;
-            }
-            if (game.move_drone) {
-                move_drone_to_target(&entities[ENTITY_DRONE], delta_time, false);
-            }
-
-            // Update world
-            update_asteroids_optimized(asteroids, ASTEROID_COUNT, delta_time);
-            update_resources(resources, RESOURCE_COUNT, delta_time);
-            update_particles(delta_time);
-
-            // Rotate station slowly
-            entities[ENTITY_STATION].rotation.v[1] += delta_time * 0.1f;
-            if (entities[ENTITY_STATION].rotation.v[1] > TWO_PI) {
-                entities[ENTITY_STATION].rotation.v[1] -= TWO_PI;
-            }
-            entities[ENTITY_STATION_V].rotation.v[0] += delta_time * 0.1f;
-            if (entities[ENTITY_STATION_V].rotation.v[0] > TWO_PI) {
-                entities[ENTITY_STATION_V].rotation.v[0] -= TWO_PI;
-            }
-
-
-
-
-
-
-            float roation_speed = 0.9f;
-            // game.hauled_resources, rotate the loader faster for 2 secons
-            if (game.hauled_resources) {
-                if (game.hauled_resources_timer < 1.0f) {
-                    roation_speed = 0.9f + (2.7f * (game.hauled_resources_timer / 1.0f));
-                } else {
-                    roation_speed = 3.6f;
-                }
-                game.hauled_resources_timer += delta_time;
-                if (game.hauled_resources_timer >= 4.0f) {
-                    game.hauled_resources = false;
-                    game.hauled_resources_timer = 0.0f;
-                }
-
-                // Spawn celebration particles around the loader
-                spawn_loader_sparks(entities[ENTITY_LOADER].position);
-            }
-            entities[ENTITY_LOADER].rotation.v[1] -= delta_time * roation_speed;
-            if (entities[ENTITY_LOADER].rotation.v[1] < 0.0f) {
-                entities[ENTITY_LOADER].rotation.v[1] += TWO_PI;
-            }
-
-            entities[ENTITY_LOADER_VERT].rotation.v[0] += delta_time * roation_speed;
-            if (entities[ENTITY_LOADER_VERT].rotation.v[0] < 0.0f) {
-                entities[ENTITY_LOADER_VERT].rotation.v[0] += TWO_PI;
+            if (game.accumulator >= FIXED_TIMESTEP) {
+                game.accumulator = 0.0f;  // Drop time we couldn't simulate
             }
+            game.render_alpha = game.accumulator / FIXED_TIMESTEP;
 
-
-            // Update matrices
-            update_entity_matrices(entities, ENTITY_COUNT);
-
-            // Compute visibility (asteroids use optimized distance-based culling)
-            compute_asteroid_visibility(asteroids, asteroid_visible, ASTEROID_COUNT);
-            compute_visibility(resources, resource_visible, RESOURCE_COUNT);
-
-            // Note: Asteroid matrices are now handled in draw_asteroids_optimized()
-            // using the matrix pool - no per-asteroid matrix updates needed here
-
-            // Resource matrices
-            for (int i = 0; i < RESOURCE_COUNT; i++) {
-                if (resource_visible[i]) {
-                    update_entity_matrix(&resources[i]);
-                }
-            }
-
-            // Reset colors
-            reset_resource_colors(resources, RESOURCE_COUNT);
-
-            // Collision detection
-            check_cursor_resource_collisions(&entities[ENTITY_CURSOR], resources, RESOURCE_COUNT, delta_time);
-            check_cursor_station_collision(&entities[ENTITY_CURSOR], &entities[ENTITY_STATION]);
-            check_drone_resource_collisions(&entities[ENTITY_DRONE], resources, RESOURCE_COUNT, delta_time);
-            check_drone_station_collisions(&entities[ENTITY_DRONE], &entities[ENTITY_STATION], 1);
-
-            if (game.drone_heal) {
-                check_drone_cursor_collisions(&entities[ENTITY_DRONE], &entities[ENTITY_CURSOR], 1);
-            }
-
-            if (cursor_entity->value > 0 && game.ship_fuel > 0) {
-                game.disabled_controls = false;
-            } else  {
-                game.disabled_controls = true;
-            }
-
-            // Asteroid collisions at ~30Hz (using optimized functions)
-            game.collision_timer += delta_time;
-            if (game.collision_timer >= 0.033f) {
-                check_cursor_asteroid_deflection_opt(&entities[ENTITY_CURSOR], asteroids, ASTEROID_COUNT);
-                check_cursor_asteroid_collisions_opt(&entities[ENTITY_CURSOR], asteroids, ASTEROID_COUNT, asteroid_visible, delta_time);
-                game.collision_timer = 0.0f;
-            }
-
-            check_loader_asteroid_collisions_opt(&entities[ENTITY_LOADER], asteroids, ASTEROID_COUNT, delta_time);
-
-            // Update deflection timer
-            update_deflect_timer(delta_time);
-
-            // Update rumble timer
-            update_rumble(delta_time);
-
-            // Update death timer (when cursor health = 0)
-            if (entities[ENTITY_CURSOR].value <= 0 || game.ship_fuel <= 0) {
-                if (!game.death_timer_active) {
-                    game.death_timer_active = true;
-                    game.death_timer = 0.0f;
-                }
-
-                game.death_timer += delta_time;
-                if (game.death_timer >= 10.0f) {
-                    // 10 seconds reached - show game over menu
-                    game.game_over = true;
-                    game.game_over_pause = true;
-                    game.menu_selection = 0;  // Reset menu selection for Continue/Quit
-                    game.death_timer = 10.0f;
-                    stop_rumble();
-                    // Don't set reset here - let the menu handle it
-                }
-            } else {
-                // Reset if health restored
-                game.death_timer_active = false;
-                game.death_timer = 0.0f;
-            }
-
-
-            update_color_flashes(delta_time);
+            // Camera follows the interpolated ship so it doesn't judder against it
+            T3DVec3 render_cursor_position, render_cursor_rotation;
+            get_entity_interpolated(cursor_entity, game.render_alpha,
+                                    &render_cursor_position, &render_cursor_rotation);
+            update_camera(&viewport, game.cam_yaw, delta_time, render_cursor_position, game.fps_mode, cursor_entity);
             update_fps_stats(delta_time);
-            update_ship_fuel(delta_time, game.ship_acceleration);
-            update_difficulty(delta_time);
 
             game.blink_timer++;
             if (game.blink_timer > 20) game.blink_timer = 0;
@@ -1570,7 +1584,7 @@ int main(void) {
                 game.state = STATE_COUNTDOWN;
                 game.countdown_timer = 3.0f;
                 for (int i = 0; i < ASTEROID_COUNT; i++) {
-                    reset_asteroid(&asteroids[i]);
+                    reset_asteroid(&asteroids, i);
                 }
                 for (int i = 0; i < RESOURCE_COUNT; i++) {
                     reset_entity(&resources[i], RESOURCE);
@@ -1598,13 +1612,21 @@ int main(void) {
             game.reset = false;
         }
 
+        PROFILE_BEGIN(PROF_VISIBILITY);
+        cull_scene(&viewport);
+        PROFILE_END(PROF_VISIBILITY);
+
+        PROFILE_BEGIN(PROF_RENDER);
+        build_frame_matrices(game.render_alpha);
+        PROFILE_END(PROF_RENDER);
         render_frame(&viewport, background, game.cam_yaw, delta_time);
-        update_audio();
-        rspq_wait();
-        update_audio();  // Extra call to prevent audio stutter at low framerates
+        // No rspq_wait() here: the RCP draws this frame while the CPU simulates
+        // the next one. display_get() throttles us to FB_COUNT frames in flight.
     }
 
     // Cleanup
+    rspq_wait();  // RCP may still reference buffers freed below
+    free_freeze_surface();
     cleanup_particles();
     sprite_free(background);
     sprite_free(station_icon);
@@ -1613,15 +1635,18 @@ int main(void) {
     // sprite_free(drone_icon);
     sprite_free(drone_full_icon);
 
+    stop_bgm();
+
     wav64_close(&sfx_mining);
     wav64_close(&sfx_dcom);
     wav64_close(&sfx_dfull);
     wav64_close(&sfx_shiphit);
 
-    stop_bgm();
     free_all_entities(entities, ENTITY_COUNT);
+    free_hud_cache();
     free_shared_models();  // Frees asteroid model and matrix pool
     free_all_entities_shared(resources, RESOURCE_COUNT);  // Resources use shared model
+    entity_pool_free();
     t3d_destroy();
     return 0;
 }
\ No newline at end of file
@@ -2,11 +2,14 @@
 #include <t3d/t3d.h>
 #include <t3d/tpx.h>
 #include <stdlib.h>
+#include <malloc.h>
 #include <math.h>
 #include "types.h"
 #include "constants.h"
-#include "camera.h"
 #include "utils.h"
+#include "game_state.h"
+#include "camera.h"
+#include "culling.h"
 
 // =============================================================================
 // Configuration
@@ -14,48 +17,187 @@
 
 #define MAX_PARTICLES 728
 #define MAX_AMBIENT_PARTICLES 456
+#define PARTICLE_WORLD_SCALE 10.0f  // TPX matrix scale: particle units -> world units
+
+// TPX positions are int8 relative to the particle matrix, so particles are drawn
+// in XZ chunks around fixed chunk centres instead of around the camera. The chunk
+// grid spans the whole 12.4 range (+/-2048), putting every particle within 512
+// units of its chunk centre.
+#define PARTICLE_CHUNK_SHIFT 14     // 12.4 -> 1024-unit chunk
+#define PARTICLE_CHUNK_DIM   4
+#define PARTICLE_CHUNK_COUNT (PARTICLE_CHUNK_DIM * PARTICLE_CHUNK_DIM)
+
+// The ambient field only fills the play area, which would land it in the four
+// central chunks. It gets a finer grid of its own so sector culling has
+// something to skip: 8x8 sectors of 256 units spanning +/-1024.
+#define AMBIENT_SECTOR_SHIFT  12    // 12.4 -> 256-unit sector
+#define AMBIENT_SECTOR_DIM    8
+#define AMBIENT_SECTOR_COUNT  (AMBIENT_SECTOR_DIM * AMBIENT_SECTOR_DIM)
+#define AMBIENT_DRAW_DISTANCE 1225.0f   // XZ camera distance past a sector's bounds
+
+_Static_assert((AMBIENT_SECTOR_DIM << (AMBIENT_SECTOR_SHIFT - 5)) > (int)PLAY_AREA_SIZE,
+               "Ambient sectors must cover the play area");
+
+#define MAX_GRID_CELLS AMBIENT_SECTOR_COUNT
+
+#define TRAIL_DRAW_POINTS (TRAIL_SAMPLES * TRAIL_SUBDIVISIONS)
+#define MAX_STAGED_PARTICLES (MAX_PARTICLES + TRAIL_DRAW_POINTS)
+
+// TPX records hold two particles each, plus one pad per chunk to keep counts even
+#define TPX_BUFFER_SIZE ((MAX_STAGED_PARTICLES + PARTICLE_CHUNK_COUNT) / 2)
+#define AMBIENT_TPX_SIZE ((MAX_AMBIENT_PARTICLES + AMBIENT_SECTOR_COUNT) / 2)
+
+// ParticleData fixed-point formats
+#define PARTICLE_POS_ONE     16.0f      // 12.4
+#define PARTICLE_VEL_ONE     64.0f      // 10.6
+#define PARTICLE_SIZE_ONE    4096.0f
 
 // =============================================================================
 // Debug
 // =============================================================================
 
 int debug_particle_count = 0;
+int debug_particles_dropped = 0;
+int debug_particles_evicted = 0;
+
+// =============================================================================
+// Emitters
+// =============================================================================
+// Each pooled effect spawns through its emitter: a cap on its own live particles, a
+// priority for pool eviction, and a spawn count that thins out with distance.
+
+typedef enum {
+    EMITTER_MINING,
+    EMITTER_LOADER,
+    EMITTER_EXPLOSION,
+    EMITTER_COUNT
+} ParticleEmitter;
+
+typedef struct {
+    uint16_t budget;        // Max live particles from this emitter
+    uint8_t priority;       // A full pool evicts particles of equal or lower priority
+    uint8_t min_count;      // Spawn count at PARTICLE_LOD_FAR and beyond
+} EmitterConfig;
+
+// Budgets deliberately oversubscribe the pool: each one caps a runaway emitter,
+// and when they collide the pool fills and priority eviction decides who
+// stays. Explosions may take the whole pool.
+#define MINING_BUDGET       128
+#define LOADER_BUDGET       128
+#define EXPLOSION_BUDGET    MAX_PARTICLES
+
+_Static_assert(MINING_BUDGET + LOADER_BUDGET + EXPLOSION_BUDGET > MAX_PARTICLES,
+               "Emitter budgets must oversubscribe the pool or eviction never runs");
+
+static const EmitterConfig emitter_config[EMITTER_COUNT] = {
+    [EMITTER_MINING]    = { MINING_BUDGET,    1, 1 },
+    [EMITTER_LOADER]    = { LOADER_BUDGET,    1, 2 },
+    [EMITTER_EXPLOSION] = { EXPLOSION_BUDGET, 2, 4 },
+};
+
+#define PARTICLE_LOD_NEAR   300.0f      // Full spawn count inside this camera distance
+#define PARTICLE_LOD_FAR    1200.0f
+#define MAX_EVICT_BATCH     16          // Largest burst that can evict
 
 
 // =============================================================================
-// Ambient Particle Structure
+// Staging Structures
 // =============================================================================
 
+// Square XZ grid centred on the origin; each cell draws under its own fixed matrix
+typedef struct {
+    int shift;              // 12.4 position -> cell
+    int dim;                // Cells per axis
+    T3DMat4FP *matrices;    // One per cell, built at init (uncached)
+} CellGrid;
+
+// A visible particle waiting to be bucketed into its cell
+typedef struct {
+    int16_t position[3];    // 12.4 world
+    uint8_t color[4];
+    int8_t size;
+    uint8_t cell;
+} StagedParticle;
+
+// Particle range of each cell in a packed TPX buffer (particles, not records)
 typedef struct {
-    T3DVec3 position;
-    float size;
-    bool active;
-} AmbientParticle;
+    int start[MAX_GRID_CELLS];
+    int end[MAX_GRID_CELLS];
+} ChunkRanges;
+
+typedef struct {
+    float x, y, z, radius;
+} ChunkBounds;
 
 // =============================================================================
 // Static Data
 // =============================================================================
 
-static AmbientParticle ambient_particles[MAX_AMBIENT_PARTICLES];
-static ParticleData particle_data[MAX_PARTICLES];
-static TPXParticle *tpx_particles = NULL;
+static ParticleData particle_data[MAX_PARTICLES];   // [0, live_particle_count) are alive
+static int live_particle_count = 0;
+static uint16_t emitter_live[EMITTER_COUNT];
+
+// Ship trail: ring of recent exhaust positions, newest at trail_head
+typedef struct {
+    float x, z;
+    color_t color;
+    uint16_t age_ms;
+    uint16_t tick;        // Sim tick it was recorded on (wraps)
+} TrailSample;
+
+static TrailSample trail_samples[TRAIL_SAMPLES];
+static int trail_head = 0;
+static int trail_count = 0;
+static uint16_t trail_tick = 0;               // Advanced by update_particles()
+static TPXParticle *tpx_particles = NULL;     // FB_COUNT buffers of TPX_BUFFER_SIZE (cached)
 static sprite_t *particle_sprite = NULL;
-static T3DMat4FP *particle_matrix = NULL;
+static CellGrid chunk_grid = { PARTICLE_CHUNK_SHIFT, PARTICLE_CHUNK_DIM, NULL };
+static CellGrid sector_grid = { AMBIENT_SECTOR_SHIFT, AMBIENT_SECTOR_DIM, NULL };
+
+static StagedParticle staged_particles[MAX_STAGED_PARTICLES];
+static ChunkRanges live_chunks;
+
+// Ambient field: never moves, so it is encoded once and drawn per sector
+static TPXParticle *ambient_tpx = NULL;       // AMBIENT_TPX_SIZE (uncached)
+static ChunkRanges ambient_sectors;
+static ChunkBounds ambient_bounds[AMBIENT_SECTOR_COUNT];
 
 // =============================================================================
 // Initialization
 // =============================================================================
 
+// 12.4 coordinate of a cell's centre along one axis
+static int grid_cell_center(const CellGrid *grid, int cell) {
+    int half_extent = grid->dim << (grid->shift - 1);
+    return (cell << grid->shift) - half_extent + (1 << (grid->shift - 1));
+}
+
+static void init_cell_matrices(CellGrid *grid) {
+    int cell_count = grid->dim * grid->dim;
+    grid->matrices = malloc_uncached(sizeof(T3DMat4FP) * cell_count);
+    for (int c = 0; c < cell_count; c++) {
+        float center_x = grid_cell_center(grid, c % grid->dim) / PARTICLE_POS_ONE;
+        float center_z = grid_cell_center(grid, c / grid->dim) / PARTICLE_POS_ONE;
+        t3d_mat4fp_from_srt_euler(&grid->matrices[c],
+            (float[]){PARTICLE_WORLD_SCALE, PARTICLE_WORLD_SCALE, PARTICLE_WORLD_SCALE},
+            (float[]){0, 0, 0},
+            (float[]){center_x, 0, center_z}
+        );
+    }
+}
+
 void init_particles(void) {
     particle_sprite = sprite_load("rom:/particle.sprite");
-    tpx_particles = malloc_uncached(sizeof(TPXParticle) * MAX_PARTICLES);
-    particle_matrix = malloc_uncached(sizeof(T3DMat4FP));
+    // Cached: filled with plain stores, then written back once per frame
+    tpx_particles = memalign(16, sizeof(TPXParticle) * TPX_BUFFER_SIZE * FB_COUNT);
+    ambient_tpx = malloc_uncached(sizeof(TPXParticle) * AMBIENT_TPX_SIZE);
+
+    init_cell_matrices(&chunk_grid);
+    init_cell_matrices(&sector_grid);
 
     tpx_init((TPXInitParams){});
 
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        particle_data[i].active = false;
-    }
+    live_particle_count = 0;
 }
 
 void cleanup_particles(void) {
@@ -64,46 +206,155 @@ void cleanup_particles(void) {
         particle_sprite = NULL;
     }
     if (tpx_particles) {
-        free_uncached(tpx_particles);
+        free(tpx_particles);
         tpx_particles = NULL;
     }
-    if (particle_matrix) {
-        free_uncached(particle_matrix);
-        particle_matrix = NULL;
+    if (ambient_tpx) {
+        free_uncached(ambient_tpx);
+        ambient_tpx = NULL;
+    }
+    if (chunk_grid.matrices) {
+        free_uncached(chunk_grid.matrices);
+        chunk_grid.matrices = NULL;
+    }
+    if (sector_grid.matrices) {
+        free_uncached(sector_grid.matrices);
+        sector_grid.matrices = NULL;
     }
 }
 
 void clear_all_particles(void) {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        particle_data[i].active = false;
-    }
+    live_particle_count = 0;
+    for (int e = 0; e < EMITTER_COUNT; e++) emitter_live[e] = 0;
+    trail_count = 0;
 }
 
 // =============================================================================
 // Particle Spawning
 // =============================================================================
 
-static int get_free_particle(void) {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (!particle_data[i].active) {
-            return i;
+static int16_t to_fixed16(float value, float one) {
+    float scaled = value * one;
+    if (scaled > 32767.0f) return 32767;
+    if (scaled < -32768.0f) return -32768;
+    return (int16_t)scaled;
+}
+
+// Reserves up to `count` contiguous records at the end of the live range.
+// Returns how many were reserved (fewer when the pool is nearly full).
+static int alloc_particles(int count, ParticleData **out) {
+    int available = MAX_PARTICLES - live_particle_count;
+    if (count > available) count = available;
+
+    *out = &particle_data[live_particle_count];
+    live_particle_count += count;
+    return count;
+}
+
+static void init_particle(ParticleData *p, T3DVec3 position, T3DVec3 velocity, color_t color, float size, float lifetime) {
+    for (int axis = 0; axis < 3; axis++) {
+        p->position[axis] = to_fixed16(position.v[axis], PARTICLE_POS_ONE);
+        p->velocity[axis] = to_fixed16(velocity.v[axis], PARTICLE_VEL_ONE);
+    }
+    p->color = color;
+
+    int lifetime_ms = (int)(lifetime * 1000.0f);
+    if (lifetime_ms < 16) lifetime_ms = 16;  // Keeps fade_rate within 16 bits
+    p->lifetime_ms = (uint16_t)lifetime_ms;
+    p->fade_rate = (uint16_t)((255 << 12) / lifetime_ms);
+    p->size = (uint8_t)(size * PARTICLE_SIZE_ONE);
+}
+
+static void remove_particle(int index) {
+    emitter_live[particle_data[index].emitter]--;
+    particle_data[index] = particle_data[--live_particle_count];
+}
+
+// Frees up to `count` slots by removing the lowest-priority, closest-to-death
+// particles at or below `priority`. One pass over the pool.
+static void evict_particles(int priority, int count) {
+    if (count > MAX_EVICT_BATCH) count = MAX_EVICT_BATCH;
+
+    int eligible = 0;
+    for (int e = 0; e < EMITTER_COUNT; e++) {
+        if (emitter_config[e].priority <= priority) eligible += emitter_live[e];
+    }
+    if (eligible == 0) return;
+
+    // Smallest keys so far, ascending
+    uint32_t victim_key[MAX_EVICT_BATCH];
+    int victim_index[MAX_EVICT_BATCH];
+    int found = 0;
+
+    for (int i = 0; i < live_particle_count; i++) {
+        const ParticleData *p = &particle_data[i];
+        int p_priority = emitter_config[p->emitter].priority;
+        if (p_priority > priority) continue;
+
+        uint32_t key = ((uint32_t)p_priority << 16) | p->lifetime_ms;
+        if (found == count && key >= victim_key[found - 1]) continue;
+
+        int j = (found < count) ? found++ : found - 1;
+        while (j > 0 && victim_key[j - 1] > key) {
+            victim_key[j] = victim_key[j - 1];
+            victim_index[j] = victim_index[j - 1];
+            j--;
+        }
+        victim_key[j] = key;
+        victim_index[j] = i;
+    }
+
+    // Highest index first, so swap-remove never moves a pending victim
+    for (int i = 1; i < found; i++) {
+        int index = victim_index[i];
+        int j = i;
+        while (j > 0 && victim_index[j - 1] < index) {
+            victim_index[j] = victim_index[j - 1];
+            j--;
         }
+        victim_index[j] = index;
     }
-    return -1;
+    for (int i = 0; i < found; i++) {
+        remove_particle(victim_index[i]);
+    }
+    debug_particles_evicted += found;
 }
 
-static void spawn_particle(T3DVec3 position, T3DVec3 velocity, color_t color, float size, float lifetime) {
-    int idx = get_free_particle();
-    if (idx < 0) return;
+// Scales a burst down linearly between PARTICLE_LOD_NEAR and PARTICLE_LOD_FAR
+static int lod_spawn_count(ParticleEmitter emitter, int count, T3DVec3 position) {
+    int min_count = emitter_config[emitter].min_count;
+    if (count <= min_count) return count;
 
-    ParticleData *p = &particle_data[idx];
-    p->position = position;
-    p->velocity = velocity;
-    p->color = color;
-    p->size = size * 1.0f;
-    p->lifetime = lifetime;
-    p->max_lifetime = lifetime;
-    p->active = true;
+    float dx = position.v[0] - camera.position.v[0];
+    float dy = position.v[1] - camera.position.v[1];
+    float dz = position.v[2] - camera.position.v[2];
+    float dist_sq = dx * dx + dy * dy + dz * dz;
+    if (dist_sq <= PARTICLE_LOD_NEAR * PARTICLE_LOD_NEAR) return count;
+    if (dist_sq >= PARTICLE_LOD_FAR * PARTICLE_LOD_FAR) return min_count;
+
+    float t = (sqrtf(dist_sq) - PARTICLE_LOD_NEAR) / (PARTICLE_LOD_FAR - PARTICLE_LOD_NEAR);
+    return count - (int)((count - min_count) * t + 0.5f);
+}
+
+// Reserves a burst for `emitter`: LOD-scaled, clamped to the emitter budget,
+// evicting lower-priority particles if the pool is full. Returns the count
+// reserved; the caller initializes each record.
+static int emit_particles(ParticleEmitter emitter, T3DVec3 position, int count, ParticleData **out) {
+    count = lod_spawn_count(emitter, count, position);
+    int requested = count;
+
+    int budget_left = emitter_config[emitter].budget - emitter_live[emitter];
+    if (count > budget_left) count = budget_left > 0 ? budget_left : 0;
+
+    int pool_left = MAX_PARTICLES - live_particle_count;
+    if (count > pool_left) evict_particles(emitter_config[emitter].priority, count - pool_left);
+
+    count = alloc_particles(count, out);
+    for (int i = 0; i < count; i++) (*out)[i].emitter = (uint8_t)emitter;
+    emitter_live[emitter] += count;
+
+    debug_particles_dropped += requested - count;
+    return count;
 }
 
 void spawn_explosion(T3DVec3 position, color_t color) {
@@ -111,40 +362,48 @@ void spawn_explosion(T3DVec3 position, color_t color) {
         color = COLOR_SPARKS;
     }
 
-    for (int i = 0; i < 16; i++) {
+    ParticleData *burst;
+    int count = emit_particles(EMITTER_EXPLOSION, position, 16, &burst);
+    for (int i = 0; i < count; i++) {
         T3DVec3 velocity = {{
             (rand() % 250 - 100) * 1.0f,
             (rand() % 80 + 20) * 1.0f,
             (rand() % 250 - 100) * 1.0f
         }};
-        spawn_particle(position, velocity, color, 0.04f, 0.4f);
+        init_particle(&burst[i], position, velocity, color, 0.04f, 0.4f);
     }
 }
 
 void spawn_mining_sparks(T3DVec3 position) {
-    for (int i = 0; i < 4; i++) {
+    ParticleData *burst;
+    int count = emit_particles(EMITTER_MINING, position, 4, &burst);
+    for (int i = 0; i < count; i++) {
         T3DVec3 velocity = {{
             (rand() % 200 - 100) * 0.75f,
             (rand() % 90 + 20) * 1.0f,
             (rand() % 200 - 100) * 0.75f
         }};
-        spawn_particle(position, velocity, COLOR_RESOURCE, 0.03f, 0.6f);
+        init_particle(&burst[i], position, velocity, COLOR_RESOURCE, 0.03f, 0.6f);
     }
 }
 
 void spawn_loader_sparks(T3DVec3 position) {
     trigger_rumble(0.01f);
-    for (int i = 0; i < 6; i++) {
+    ParticleData *burst;
+    int count = emit_particles(EMITTER_LOADER, position, 6, &burst);
+    for (int i = 0; i < count; i++) {
         T3DVec3 velocity = {{
             (rand() % 300 - 150) * 0.5f,
             (rand() % 60 + 10) * 1.50f,
             (rand() % 300 - 150) * 0.5f
         }};
-        spawn_particle(position, velocity, COLOR_RESOURCE, 0.035f, 0.8f);
+        init_particle(&burst[i], position, velocity, COLOR_RESOURCE, 0.035f, 0.8f);
     }
 }
 
 
+// Records one exhaust sample behind the ship; call once per sim tick while
+// accelerating. The trail itself is not pooled - see stage_ship_trail().
 void spawn_ship_trail(T3DVec3 position, T3DVec3 velocity, color_t color) {
     // Only spawn if ship is moving fast enough
     float speed_sq = velocity.v[0] * velocity.v[0] + velocity.v[2] * velocity.v[2];
@@ -155,56 +414,68 @@ void spawn_ship_trail(T3DVec3 position, T3DVec3 velocity, color_t color) {
     float dir_x = -velocity.v[0] * inv_speed;
     float dir_z = -velocity.v[2] * inv_speed;
 
-    for (int i = 0; i < TRAIL_PARTICLE_COUNT; i++) {
-        // Spawn position: behind ship with slight random spread
-        float spread_x = (rand() % (int)(TRAIL_SPREAD * 2 + 1)) - TRAIL_SPREAD;
-        float spread_z = (rand() % (int)(TRAIL_SPREAD * 2 + 1)) - TRAIL_SPREAD;
-
-        T3DVec3 spawn_pos = {{
-            position.v[0] + dir_x * TRAIL_OFFSET_DISTANCE + spread_x,
-            TRAIL_HEIGHT,  // Fixed height
-            position.v[2] + dir_z * TRAIL_OFFSET_DISTANCE + spread_z
-        }};
+    trail_head = (trail_head + 1) % TRAIL_SAMPLES;
+    if (trail_count < TRAIL_SAMPLES) trail_count++;
 
-        // Particles drift outward only (no Y movement)
-        T3DVec3 particle_vel = {{
-            dir_x * 30.0f + (rand() % 20 - 10),
-            0.0f,  // No vertical movement
-            dir_z * 30.0f + (rand() % 20 - 10)
-        }};
-
-        spawn_particle(spawn_pos, particle_vel, color, TRAIL_PARTICLE_SIZE, TRAIL_LIFETIME);
-    }
+    TrailSample *sample = &trail_samples[trail_head];
+    sample->x = position.v[0] + dir_x * TRAIL_OFFSET_DISTANCE;
+    sample->z = position.v[2] + dir_z * TRAIL_OFFSET_DISTANCE;
+    sample->color = color;
+    sample->age_ms = 0;
+    sample->tick = trail_tick;
 }
 
-
 // =============================================================================
 // Particle Update
 // =============================================================================
 
+// Fixed-point step: per-tick constants are converted once, then each live
+// particle is integer-only. Dead particles are swap-removed, keeping the live
+// range packed.
 void update_particles(float delta_time) {
-    for (int i = 0; i < MAX_PARTICLES; i++) {
+    int dt_ms = (int)(delta_time * 1000.0f + 0.5f);
+    int gravity = (int)(150.0f * delta_time * PARTICLE_VEL_ONE + 0.5f);
+    int dt_q16 = (int)(delta_time * 65536.0f + 0.5f);
+    const int trail_lifetime_ms = (int)(TRAIL_LIFETIME * 1000.0f);
+
+    trail_tick++;
+
+    // Age the trail; expired samples drop off the tail
+    for (int i = 0; i < trail_count; i++) {
+        TrailSample *sample = &trail_samples[(trail_head - i + TRAIL_SAMPLES) % TRAIL_SAMPLES];
+        sample->age_ms += dt_ms;
+        if (sample->age_ms >= trail_lifetime_ms) {
+            trail_count = i;
+            break;
+        }
+    }
+
+    int i = 0;
+    while (i < live_particle_count) {
         ParticleData *p = &particle_data[i];
-        if (!p->active) continue;
 
-        p->lifetime -= delta_time;
-        if (p->lifetime <= 0) {
-            p->active = false;
+        if (p->lifetime_ms <= dt_ms) {
+            remove_particle(i);
             continue;
         }
-
-        // Gravity and drag
-        p->velocity.v[1] -= 150.0f * delta_time;
-
-        float drag = 0.98f;
-        p->velocity.v[0] *= drag;
-        p->velocity.v[1] *= 0.99f;
-        p->velocity.v[2] *= drag;
-
-        // Position update
-        p->position.v[0] += p->velocity.v[0] * delta_time;
-        p->position.v[1] += p->velocity.v[1] * delta_time;
-        p->position.v[2] += p->velocity.v[2] * delta_time;
+        p->lifetime_ms -= dt_ms;
+
+        // Gravity, then drag (x/z * 0.98, y * 0.99 in /256 steps)
+        int vx = p->velocity[0];
+        int vy = p->velocity[1] - gravity;
+        int vz = p->velocity[2];
+        vx = (vx * 251) >> 8;
+        vy = (vy * 253) >> 8;
+        vz = (vz * 251) >> 8;
+        p->velocity[0] = (int16_t)vx;
+        p->velocity[1] = (int16_t)vy;
+        p->velocity[2] = (int16_t)vz;
+
+        // 10.6 velocity * 16.16 dt -> 12.4 position: shift by 6 + 16 - 4 = 18
+        p->position[0] += (int16_t)((vx * dt_q16 + (1 << 17)) >> 18);
+        p->position[1] += (int16_t)((vy * dt_q16 + (1 << 17)) >> 18);
+        p->position[2] += (int16_t)((vz * dt_q16 + (1 << 17)) >> 18);
+        i++;
     }
 }
 
@@ -212,103 +483,174 @@ void update_particles(float delta_time) {
 // Particle Drawing
 // =============================================================================
 
-void draw_particles(T3DViewport *viewport) {
-    if (!particle_sprite || !tpx_particles) return;
-
-    int active_count = 0;
-    TPXParticle *tpx = tpx_particles;
-
-    // Regular particles
-    for (int i = 0; i < MAX_PARTICLES; i++) {
-        if (!particle_data[i].active) continue;
+static int particle_chunk(const int16_t *position) {
+    int cx = (position[0] + 32768) >> PARTICLE_CHUNK_SHIFT;
+    int cz = (position[2] + 32768) >> PARTICLE_CHUNK_SHIFT;
+    return cz * PARTICLE_CHUNK_DIM + cx;
+}
 
-        ParticleData *p = &particle_data[i];
+// Only valid inside the play area (see the static assert above)
+static int ambient_sector(const int16_t *position) {
+    const int half_extent = AMBIENT_SECTOR_DIM << (AMBIENT_SECTOR_SHIFT - 1);
+    int sx = (position[0] + half_extent) >> AMBIENT_SECTOR_SHIFT;
+    int sz = (position[2] + half_extent) >> AMBIENT_SECTOR_SHIFT;
+    return sz * AMBIENT_SECTOR_DIM + sx;
+}
 
-        // Frustum culling
-        float dx = p->position.v[0] - camera.position.v[0];
-        float dz = p->position.v[2] - camera.position.v[2];
-        float dist_sq = dx * dx + dz * dz;
-        if (dist_sq > 1000000.0f) continue;
-
-        float life_ratio = p->lifetime / p->max_lifetime;
-        uint8_t alpha = (uint8_t)(life_ratio * 255);
-        float size = p->size * (0.5f + life_ratio * 0.5f);
-        int8_t size_fp = (int8_t)(size * 64);
-
-        // Position relative to camera
-        float rel_x = p->position.v[0] - camera.position.v[0];
-        float rel_y = p->position.v[1] - camera.position.v[1];
-        float rel_z = p->position.v[2] - camera.position.v[2];
-
-        int8_t px = (int8_t)(rel_x * 0.1f);
-        int8_t py = (int8_t)(rel_y * 0.1f);
-        int8_t pz = (int8_t)(rel_z * 0.1f);
-
-        tpx->posA[0] = tpx->posB[0] = px;
-        tpx->posA[1] = tpx->posB[1] = py;
-        tpx->posA[2] = tpx->posB[2] = pz;
-        tpx->sizeA = tpx->sizeB = size_fp;
-
-        uint8_t r = p->color.r, g = p->color.g, b = p->color.b;
-        tpx->colorA[0] = tpx->colorB[0] = r;
-        tpx->colorA[1] = tpx->colorB[1] = g;
-        tpx->colorA[2] = tpx->colorB[2] = b;
-        tpx->colorA[3] = tpx->colorB[3] = alpha;
-
-        tpx++;
-        active_count++;
+// Stages visible live particles. Everything but the frustum test is integer
+// math on the 12.4 positions.
+static int stage_live_particles(StagedParticle *out) {
+    const float pos_scale = 1.0f / PARTICLE_POS_ONE;
+    int count = 0;
+
+    for (int i = 0; i < live_particle_count; i++) {
+        const ParticleData *p = &particle_data[i];
+
+        float radius = p->size * (PARTICLE_WORLD_SCALE / PARTICLE_SIZE_ONE);
+        if (!frustum_sphere_visible(p->position[0] * pos_scale, p->position[1] * pos_scale,
+                                    p->position[2] * pos_scale, radius)) continue;
+
+        // Fades out and shrinks to half size over its lifetime:
+        // size * (0.5 + alpha / 510) * 64 in TPX units == size * (255 + alpha) / 32640
+        int alpha = (p->lifetime_ms * p->fade_rate) >> 12;
+        if (alpha > 255) alpha = 255;
+
+        StagedParticle *sp = &out[count++];
+        sp->position[0] = p->position[0];
+        sp->position[1] = p->position[1];
+        sp->position[2] = p->position[2];
+        sp->size = (int8_t)((p->size * (255 + alpha) * 257) >> 23);
+        sp->color[0] = p->color.r;
+        sp->color[1] = p->color.g;
+        sp->color[2] = p->color.b;
+        sp->color[3] = (uint8_t)alpha;
+        sp->cell = (uint8_t)particle_chunk(sp->position);
     }
+    return count;
+}
 
-    // Ambient particles
-    for (int i = 0; i < MAX_AMBIENT_PARTICLES; i++) {
-        AmbientParticle *ap = &ambient_particles[i];
-        if (!ap->active) continue;
-
-        float dx = ap->position.v[0] - camera.position.v[0];
-        float dz = ap->position.v[2] - camera.position.v[2];
-        float dist_sq = dx * dx + dz * dz;
-        if (dist_sq > 1500000.0f) continue;
+// Draws the trail as runs of sprites along the sample ring, newest to oldest,
+// fading out and tapering to half size with age. Samples recorded on
+// non-consecutive ticks (the ship coasted in between) are not joined.
+static int stage_ship_trail(StagedParticle *out) {
+    if (trail_count < 2) return 0;
+
+    const float inv_lifetime_ms = 1.0f / (TRAIL_LIFETIME * 1000.0f);
+    const float inv_steps = 1.0f / TRAIL_SUBDIVISIONS;
+    int count = 0;
+
+    for (int i = 0; i < trail_count - 1; i++) {
+        const TrailSample *a = &trail_samples[(trail_head - i + TRAIL_SAMPLES) % TRAIL_SAMPLES];
+        const TrailSample *b = &trail_samples[(trail_head - i - 1 + TRAIL_SAMPLES) % TRAIL_SAMPLES];
+        int steps = ((uint16_t)(a->tick - b->tick) > 1) ? 1 : TRAIL_SUBDIVISIONS;
+
+        for (int step = 0; step < steps; step++) {
+            float t = step * inv_steps;
+            float fade = 1.0f - (a->age_ms + (b->age_ms - a->age_ms) * t) * inv_lifetime_ms;
+            if (fade <= 0.0f) break;
+
+            StagedParticle *sp = &out[count++];
+            sp->position[0] = to_fixed16(a->x + (b->x - a->x) * t, PARTICLE_POS_ONE);
+            sp->position[1] = to_fixed16(TRAIL_HEIGHT, PARTICLE_POS_ONE);
+            sp->position[2] = to_fixed16(a->z + (b->z - a->z) * t, PARTICLE_POS_ONE);
+            sp->size = (int8_t)(TRAIL_PARTICLE_SIZE * 64.0f * (0.5f + 0.5f * fade) + 0.5f);
+            sp->color[0] = a->color.r;
+            sp->color[1] = a->color.g;
+            sp->color[2] = a->color.b;
+            sp->color[3] = (uint8_t)(fade * 255.0f);
+            sp->cell = (uint8_t)particle_chunk(sp->position);
+        }
+    }
+    return count;
+}
 
-        int8_t size_fp = (int8_t)(ap->size * 64);
+// Writes one particle into half of a TPX record (each record holds two).
+// Position is relative to the cell centre, world / 10 (the cell matrix
+// scales back up), rounded: 12.4 / 160.
+static void encode_tpx_particle(TPXParticle *tpx, int half, const StagedParticle *sp,
+                                const CellGrid *grid) {
+    int rel_x = sp->position[0] - grid_cell_center(grid, sp->cell % grid->dim);
+    int rel_z = sp->position[2] - grid_cell_center(grid, sp->cell / grid->dim);
+    int rel_y = sp->position[1];
+
+    int8_t *pos = half ? tpx->posB : tpx->posA;
+    uint8_t *color = half ? tpx->colorB : tpx->colorA;
+    pos[0] = (int8_t)((rel_x * 410 + 32768) >> 16);
+    pos[1] = (int8_t)((rel_y * 410 + 32768) >> 16);
+    pos[2] = (int8_t)((rel_z * 410 + 32768) >> 16);
+    color[0] = sp->color[0];
+    color[1] = sp->color[1];
+    color[2] = sp->color[2];
+    color[3] = sp->color[3];
+    if (half) tpx->sizeB = sp->size;
+    else tpx->sizeA = sp->size;
+}
 
-        float rel_x = ap->position.v[0] - camera.position.v[0];
-        float rel_y = ap->position.v[1] - camera.position.v[1];
-        float rel_z = ap->position.v[2] - camera.position.v[2];
+// Buckets staged particles by cell into TPX records. Each cell starts on a
+// record boundary; an odd cell repeats its last particle in the spare half.
+// Returns the number of records written.
+static int pack_particle_chunks(const StagedParticle *staged, int count, const CellGrid *grid,
+                                TPXParticle *out, ChunkRanges *ranges) {
+    int cell_count = grid->dim * grid->dim;
+    int cell_counts[MAX_GRID_CELLS] = {0};
+    for (int i = 0; i < count; i++) cell_counts[staged[i].cell]++;
+
+    int slot = 0;
+    for (int c = 0; c < cell_count; c++) {
+        ranges->start[c] = slot;
+        ranges->end[c] = slot;
+        slot += (cell_counts[c] + 1) & ~1;
+    }
 
-        int8_t px = (int8_t)(rel_x * 0.1f);
-        int8_t py = (int8_t)(rel_y * 0.1f);
-        int8_t pz = (int8_t)(rel_z * 0.1f);
+    for (int i = 0; i < count; i++) {
+        const StagedParticle *sp = &staged[i];
+        int s = ranges->end[sp->cell]++;
+        encode_tpx_particle(&out[s >> 1], s & 1, sp, grid);
+        if ((s & 1) == 0) {
+            // Pad the spare half now; a second particle in this cell overwrites it
+            encode_tpx_particle(&out[s >> 1], 1, sp, grid);
+        }
+    }
 
-        tpx->posA[0] = tpx->posB[0] = px;
-        tpx->posA[1] = tpx->posB[1] = py;
-        tpx->posA[2] = tpx->posB[2] = pz;
-        tpx->sizeA = tpx->sizeB = size_fp;
+    for (int c = 0; c < cell_count; c++) {
+        ranges->end[c] = (ranges->end[c] + 1) & ~1;
+    }
+    return slot / 2;
+}
 
-        tpx->colorA[0] = tpx->colorB[0] = 200;
-        tpx->colorA[1] = tpx->colorB[1] = 74;
-        tpx->colorA[2] = tpx->colorB[2] = 28;
-        tpx->colorA[3] = tpx->colorB[3] = 255;
+void draw_particles(T3DViewport *viewport) {
+    if (!particle_sprite || !tpx_particles) return;
 
+    // Write into this frame's slot - the RCP may still be reading the others
+    TPXParticle *frame_particles = &tpx_particles[game.frame_idx * TPX_BUFFER_SIZE];
 
-        tpx++;
-        active_count++;
+    int staged = stage_live_particles(staged_particles);
+    staged += stage_ship_trail(staged_particles + staged);
+    int record_count = pack_particle_chunks(staged_particles, staged, &chunk_grid,
+                                            frame_particles, &live_chunks);
+    if (record_count > 0) {
+        data_cache_hit_writeback(frame_particles, sizeof(TPXParticle) * record_count);
     }
 
-    debug_particle_count = active_count;
-
-    // TPX requires even count
-    if (active_count & 1) {
-        active_count--;
+    // Ambient sectors are culled whole, by distance then frustum
+    bool ambient_visible[AMBIENT_SECTOR_COUNT];
+    int ambient_count = 0;
+    for (int c = 0; c < AMBIENT_SECTOR_COUNT; c++) {
+        const ChunkBounds *b = &ambient_bounds[c];
+        ambient_visible[c] = false;
+        if (ambient_sectors.end[c] == ambient_sectors.start[c]) continue;
+
+        float dx = b->x - camera.position.v[0];
+        float dz = b->z - camera.position.v[2];
+        float reach = AMBIENT_DRAW_DISTANCE + b->radius;
+        if (dx * dx + dz * dz > reach * reach) continue;
+
+        ambient_visible[c] = frustum_sphere_visible(b->x, b->y, b->z, b->radius);
+        if (ambient_visible[c]) ambient_count += ambient_sectors.end[c] - ambient_sectors.start[c];
     }
 
-    if (active_count < 2) return;
-
-    // Matrix at camera position with 10x scale
-    t3d_mat4fp_from_srt_euler(particle_matrix,
-        (float[]){10.0f, 10.0f, 10.0f},
-        (float[]){0, 0, 0},
-        (float[]){camera.position.v[0], camera.position.v[1], camera.position.v[2]}
-    );
+    debug_particle_count = staged + ambient_count;
+    if (record_count == 0 && ambient_count == 0) return;
 
     // Render state
     rdpq_sync_pipe();
@@ -331,13 +673,26 @@ void draw_particles(T3DViewport *viewport) {
     rdpq_sprite_upload(TILE0, particle_sprite, &tex_params);
 
     tpx_state_from_t3d();
-    tpx_matrix_push(particle_matrix);
     tpx_state_set_scale(1.0f, 1.0f);
     tpx_state_set_tex_params(0, 0);
 
-    tpx_particle_draw_tex(tpx_particles, active_count);
+    for (int c = 0; c < PARTICLE_CHUNK_COUNT; c++) {
+        int live = live_chunks.end[c] - live_chunks.start[c];
+        if (live == 0) continue;
 
-    tpx_matrix_pop(1);
+        tpx_matrix_push(&chunk_grid.matrices[c]);
+        tpx_particle_draw_tex(&frame_particles[live_chunks.start[c] / 2], live);
+        tpx_matrix_pop(1);
+    }
+
+    for (int c = 0; c < AMBIENT_SECTOR_COUNT; c++) {
+        if (!ambient_visible[c]) continue;
+
+        tpx_matrix_push(&sector_grid.matrices[c]);
+        tpx_particle_draw_tex(&ambient_tpx[ambient_sectors.start[c] / 2],
+                              ambient_sectors.end[c] - ambient_sectors.start[c]);
+        tpx_matrix_pop(1);
+    }
 
     rdpq_sync_pipe();
     rdpq_sync_tile();
@@ -346,16 +701,66 @@ void draw_particles(T3DViewport *viewport) {
 // =============================================================================
 // Ambient Particles
 // =============================================================================
+// Generates the field and bakes it into ambient_tpx, bucketed by sector, with
+// a bounding sphere per sector for culling
 void init_ambient_particles(void) {
-    for (int i = 0; i < MAX_AMBIENT_PARTICLES; i++) {
-        AmbientParticle *p = &ambient_particles[i];
-        p->active = true;
+    if (!ambient_tpx) return;
+
+    StagedParticle *staged = staged_particles;     // Free outside draw_particles
+    float min_pos[AMBIENT_SECTOR_COUNT][3];
+    float max_pos[AMBIENT_SECTOR_COUNT][3];
+    float max_size[AMBIENT_SECTOR_COUNT];
+    for (int c = 0; c < AMBIENT_SECTOR_COUNT; c++) {
+        for (int axis = 0; axis < 3; axis++) {
+            min_pos[c][axis] = 1e9f;
+            max_pos[c][axis] = -1e9f;
+        }
+        max_size[c] = 0.0f;
+    }
 
+    for (int i = 0; i < MAX_AMBIENT_PARTICLES; i++) {
         // Random position in play area
-        p->position.v[0] = (rand() % ((int)PLAY_AREA_SIZE * 2)) - PLAY_AREA_SIZE;
-        p->position.v[1] = 24.0f + (rand() % 77);
-        p->position.v[2] = (rand() % ((int)PLAY_AREA_SIZE * 2)) - PLAY_AREA_SIZE;
+        T3DVec3 position = {{
+            (rand() % ((int)PLAY_AREA_SIZE * 2)) - PLAY_AREA_SIZE,
+            24.0f + (rand() % 77),
+            (rand() % ((int)PLAY_AREA_SIZE * 2)) - PLAY_AREA_SIZE
+        }};
+        float size = (10 + (rand() % 31)) * 0.001f;
+
+        StagedParticle *sp = &staged[i];
+        for (int axis = 0; axis < 3; axis++) {
+            sp->position[axis] = to_fixed16(position.v[axis], PARTICLE_POS_ONE);
+        }
+        sp->size = (int8_t)(size * 64);
+        sp->color[0] = 200;
+        sp->color[1] = 74;
+        sp->color[2] = 28;
+        sp->color[3] = 255;
+        sp->cell = (uint8_t)ambient_sector(sp->position);
+
+        int c = sp->cell;
+        for (int axis = 0; axis < 3; axis++) {
+            if (position.v[axis] < min_pos[c][axis]) min_pos[c][axis] = position.v[axis];
+            if (position.v[axis] > max_pos[c][axis]) max_pos[c][axis] = position.v[axis];
+        }
+        if (size > max_size[c]) max_size[c] = size;
+    }
+
+    pack_particle_chunks(staged, MAX_AMBIENT_PARTICLES, &sector_grid, ambient_tpx, &ambient_sectors);
 
-        p->size = (10 + (rand() % 31)) * 0.001f;
+    for (int c = 0; c < AMBIENT_SECTOR_COUNT; c++) {
+        ChunkBounds *b = &ambient_bounds[c];
+        if (ambient_sectors.end[c] == ambient_sectors.start[c]) {
+            *b = (ChunkBounds){0};
+            continue;
+        }
+        float half_x = (max_pos[c][0] - min_pos[c][0]) * 0.5f;
+        float half_y = (max_pos[c][1] - min_pos[c][1]) * 0.5f;
+        float half_z = (max_pos[c][2] - min_pos[c][2]) * 0.5f;
+        b->x = min_pos[c][0] + half_x;
+        b->y = min_pos[c][1] + half_y;
+        b->z = min_pos[c][2] + half_z;
+        b->radius = sqrtf(half_x * half_x + half_y * half_y + half_z * half_z) +
+                    max_size[c] * PARTICLE_WORLD_SCALE;
     }
-}
\ No newline at end of file
+}
@@ -39,5 +39,7 @@ void init_ambient_particles(void);
 // =============================================================================
 
 extern int debug_particle_count;
+extern int debug_particles_dropped;     // Spawns refused (budget or full pool), total
+extern int debug_particles_evicted;     // Live particles replaced by higher-priority spawns, total
 
 #endif // PARTICLES_H
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "profiler.h"
+
+#ifdef FRAME_PROFILER
+
+#include <rdpq.h>
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+#define GRAPH_HEIGHT     40                         // Pixels for one frame budget
+#define GRAPH_BUDGET_US  33333                      // 30 fps frame budget
+#define LEGEND_LINE_HEIGHT 10
+
+static const char *phase_names[PROF_PHASE_COUNT] = {
+    "input", "cursor", "world", "visib", "collide", "render", "rcp", "audio"
+};
+
+static const color_t phase_colors[PROF_PHASE_COUNT] = {
+    RGBA32(255, 255, 255, 255),
+    RGBA32(0, 200, 255, 255),
+    RGBA32(0, 180, 20, 255),
+    RGBA32(255, 237, 41, 255),
+    RGBA32(255, 74, 28, 255),
+    RGBA32(220, 0, 115, 255),
+    RGBA32(90, 90, 90, 255),
+    RGBA32(138, 0, 196, 255),
+};
+
+// =============================================================================
+// State
+// =============================================================================
+
+static uint32_t history[PROFILER_HISTORY][PROF_PHASE_COUNT];  // Ticks per phase
+static int history_index = 0;
+
+static uint32_t current[PROF_PHASE_COUNT];
+static uint32_t phase_start[PROF_PHASE_COUNT];
+
+// =============================================================================
+// Timing
+// =============================================================================
+
+// Close out the previous frame and start accumulating a new one
+void profiler_frame_begin(void) {
+    for (int p = 0; p < PROF_PHASE_COUNT; p++) {
+        history[history_index][p] = current[p];
+        current[p] = 0;
+    }
+    history_index = (history_index + 1) % PROFILER_HISTORY;
+}
+
+void profiler_begin(ProfilePhase phase) {
+    phase_start[phase] = (uint32_t)get_ticks();
+}
+
+// Phases may run several times per frame (e.g. one per sim tick) - they add up
+void profiler_end(ProfilePhase phase) {
+    current[phase] += (uint32_t)get_ticks() - phase_start[phase];
+}
+
+// =============================================================================
+// Timeline Overlay
+// =============================================================================
+
+// Stacked bars, oldest frame on the left, plus per-phase averages.
+// (x, y) is the top-left of the graph; the top edge marks the frame budget.
+void profiler_draw(int x, int y) {
+    const uint32_t ticks_per_pixel = TICKS_FROM_US(GRAPH_BUDGET_US) / GRAPH_HEIGHT;
+    int bottom = y + GRAPH_HEIGHT;
+
+    rdpq_sync_pipe();
+    rdpq_set_mode_standard();
+    rdpq_mode_combiner(RDPQ_COMBINER_FLAT);
+
+    // Frame budget line
+    rdpq_set_prim_color(RGBA32(255, 255, 255, 255));
+    rdpq_fill_rectangle(x, y - 1, x + PROFILER_HISTORY, y);
+
+    uint32_t totals[PROF_PHASE_COUNT] = {0};
+
+    for (int f = 0; f < PROFILER_HISTORY; f++) {
+        uint32_t *frame = history[(history_index + f) % PROFILER_HISTORY];
+        int bar_top = bottom;
+
+        for (int p = 0; p < PROF_PHASE_COUNT; p++) {
+            totals[p] += frame[p];
+
+            int height = frame[p] / ticks_per_pixel;
+            if (bar_top - height < y) height = bar_top - y;  // Clip over-budget frames
+            if (height <= 0) continue;
+
+            rdpq_set_prim_color(phase_colors[p]);
+            rdpq_fill_rectangle(x + f, bar_top - height, x + f + 1, bar_top);
+            bar_top -= height;
+        }
+    }
+
+    // Legend with average milliseconds per phase
+    int legend_x = x + PROFILER_HISTORY + 6;
+    int legend_y = y + 6;
+
+    for (int p = 0; p < PROF_PHASE_COUNT; p++) {
+        float avg_ms = TICKS_TO_US(totals[p] / PROFILER_HISTORY) / 1000.0f;
+
+        rdpq_set_prim_color(phase_colors[p]);
+        rdpq_fill_rectangle(legend_x, legend_y - 6, legend_x + 6, legend_y);
+
+        rdpq_text_printf(NULL, FONT_BUILTIN_DEBUG_MONO, legend_x + 9, legend_y,
+                         "%s %.1f", phase_names[p], avg_ms);
+        legend_y += LEGEND_LINE_HEIGHT;
+    }
+}
+
+#endif // FRAME_PROFILER
@@ -0,0 +1,49 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <libdragon.h>
+
+// =============================================================================
+// Frame Phases
+// =============================================================================
+
+typedef enum {
+    PROF_INPUT,
+    PROF_CURSOR,
+    PROF_WORLD,
+    PROF_VISIBILITY,
+    PROF_COLLISION,
+    PROF_RENDER,        // Command building / submission
+    PROF_RCP_WAIT,      // Blocked in display_get() waiting on the RCP
+    PROF_AUDIO,         // mixer_poll(), once per frame on the main thread
+    PROF_PHASE_COUNT
+} ProfilePhase;
+
+// =============================================================================
+// Profiler (build with `make PROFILE=1`; compiles to nothing otherwise)
+// =============================================================================
+
+#ifdef FRAME_PROFILER
+
+#define PROFILER_HISTORY 64     // Frames kept in the ring buffer
+
+void profiler_frame_begin(void);
+void profiler_begin(ProfilePhase phase);
+void profiler_end(ProfilePhase phase);
+void profiler_draw(int x, int y);
+
+#define PROFILE_FRAME_BEGIN()   profiler_frame_begin()
+#define PROFILE_BEGIN(phase)    profiler_begin(phase)
+#define PROFILE_END(phase)      profiler_end(phase)
+#define PROFILE_DRAW(x, y)      profiler_draw(x, y)
+
+#else
+
+#define PROFILE_FRAME_BEGIN()   ((void)0)
+#define PROFILE_BEGIN(phase)    ((void)0)
+#define PROFILE_END(phase)      ((void)0)
+#define PROFILE_DRAW(x, y)      ((void)0)
+
+#endif // FRAME_PROFILER
+
+#endif // PROFILER_H
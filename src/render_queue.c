@@ -0,0 +1,163 @@
+#include "render_queue.h"
+#include "entity.h"
+#include "entity_pool.h"
+#include "camera.h"
+#include "draw_order.h"
+#include <rdpq.h>
+#include <string.h>
+
+// =============================================================================
+// Queue Storage
+// =============================================================================
+
+typedef struct {
+    Entity *entity;
+    color_t color;            // Captured at enqueue (callers may restore it afterwards)
+    DrawType draw_type;
+    uint8_t flags;
+} RenderItem;
+
+static RenderItem pass_items[2][RENDER_QUEUE_SIZE];
+static uint32_t pass_keys[2][RENDER_QUEUE_SIZE];
+static uint16_t pass_slots[2][RENDER_QUEUE_SIZE];  // Pool slot of each item (stable ID)
+static int pass_count[2];
+
+// Last frame's sorted order is a near-perfect starting point for this frame's
+// sort. Enqueue positions shift whenever something is culled or spawned, so
+// the order is carried across frames by pool slot and mapped back to positions.
+static DrawOrder pass_order[2];
+static uint16_t prev_slots[2][RENDER_QUEUE_SIZE];
+static int prev_count[2];
+
+#define NO_ITEM 0xFF
+_Static_assert(RENDER_QUEUE_SIZE < NO_ITEM, "Queue positions must fit in a byte");
+
+// =============================================================================
+// Sort Keys
+// =============================================================================
+
+// Opaque:      [z-write off:1][draw type:4] | depth:27  (depth-writers first, then near to far)
+// Translucent: ~depth                                  (far to near; order must not be broken up by material)
+// Depth is the float's bit pattern less its sign bit and lowest mantissa bits.
+static uint32_t make_key(RenderPass pass, bool zwrite, DrawType draw_type, float distance_sq) {
+    uint32_t depth = depth_sort_key(distance_sq);
+    if (pass == RENDER_PASS_TRANSLUCENT) {
+        return ~depth;
+    }
+    uint32_t state = ((zwrite ? 0u : 1u) << 4) | ((uint32_t)draw_type & 0xF);
+    return (state << 27) | (depth >> 4);
+}
+
+// =============================================================================
+// Queue API
+// =============================================================================
+
+void render_queue_begin(void) {
+    pass_count[RENDER_PASS_OPAQUE] = 0;
+    pass_count[RENDER_PASS_TRANSLUCENT] = 0;
+}
+
+void render_queue_add(Entity *entity, uint8_t flags) {
+    uint8_t alpha = color_to_packed32(entity->color) & 0xFF;
+    RenderPass pass = (alpha < 255) ? RENDER_PASS_TRANSLUCENT : RENDER_PASS_OPAQUE;
+    if (pass_count[pass] >= RENDER_QUEUE_SIZE) return;
+
+    float dx = entity->position.v[0] - camera.position.v[0];
+    float dy = entity->position.v[1] - camera.position.v[1];
+    float dz = entity->position.v[2] - camera.position.v[2];
+    bool zwrite = (pass == RENDER_PASS_OPAQUE) && !(flags & RQ_NO_ZWRITE);
+
+    int index = pass_count[pass]++;
+    DrawType draw_type = entity_render(entity)->draw_type;
+    pass_keys[pass][index] = make_key(pass, zwrite, draw_type, dx * dx + dy * dy + dz * dz);
+
+    pass_slots[pass][index] = entity_pool_handle_of(entity).index;
+
+    RenderItem *item = &pass_items[pass][index];
+    item->entity = entity;
+    item->color = entity->color;
+    item->draw_type = draw_type;
+    item->flags = flags;
+}
+
+// Seed this frame's order with last frame's: items still queued keep their
+// sorted position, newly queued ones follow in enqueue order
+static void seed_order(RenderPass pass, int count) {
+    uint8_t slot_item[ENTITY_POOL_CAPACITY];
+    bool placed[RENDER_QUEUE_SIZE] = {0};
+    memset(slot_item, NO_ITEM, sizeof(slot_item));
+
+    for (int i = count - 1; i >= 0; i--) {
+        uint16_t slot = pass_slots[pass][i];
+        if (slot < ENTITY_POOL_CAPACITY) slot_item[slot] = (uint8_t)i;
+    }
+
+    uint16_t *order = pass_order[pass].order;
+    int n = 0;
+    for (int i = 0; i < prev_count[pass]; i++) {
+        uint16_t slot = prev_slots[pass][i];
+        if (slot >= ENTITY_POOL_CAPACITY || slot_item[slot] == NO_ITEM) continue;
+        order[n++] = slot_item[slot];
+        placed[slot_item[slot]] = true;
+        slot_item[slot] = NO_ITEM;
+    }
+    for (int i = 0; i < count; i++) {
+        if (!placed[i]) order[n++] = (uint16_t)i;
+    }
+    pass_order[pass].count = count;
+}
+
+// rdpq autosync inserts pipe syncs on mode changes, so eliding redundant
+// changes here is also what removes the syncs
+void render_queue_submit(RenderPass pass) {
+    int count = pass_count[pass];
+    if (count == 0) return;
+
+    seed_order(pass, count);
+    draw_order_sort(&pass_order[pass], pass_keys[pass], count);
+    const uint16_t *order = pass_order[pass].order;
+
+    for (int i = 0; i < count; i++) {
+        prev_slots[pass][i] = pass_slots[pass][order[i]];
+    }
+    prev_count[pass] = count;
+
+    // State left behind by whatever drew before us is unknown
+    int cur_zwrite = -1;
+    int cur_draw_type = -1;
+    uint32_t cur_color = 0;
+    bool color_valid = false;
+
+    for (int i = 0; i < count; i++) {
+        RenderItem *item = &pass_items[pass][order[i]];
+
+        int zwrite = (pass == RENDER_PASS_OPAQUE && !(item->flags & RQ_NO_ZWRITE)) ? 1 : 0;
+        if (zwrite != cur_zwrite) {
+            rdpq_mode_zbuf(true, zwrite);
+            cur_zwrite = zwrite;
+        }
+
+        if ((int)item->draw_type != cur_draw_type) {
+            set_entity_combiner(item->draw_type);
+            cur_draw_type = item->draw_type;
+        }
+
+        uint32_t color = color_to_packed32(item->color);
+        if (!color_valid || color != cur_color) {
+            rdpq_set_prim_color(item->color);
+            cur_color = color;
+            color_valid = true;
+        }
+
+        if (item->flags & RQ_CACHED) {
+            draw_entity_block(item->entity);
+        } else {
+            draw_entity_mesh(item->entity);
+        }
+    }
+
+    // Leave the default Z mode for the next drawer
+    if (cur_zwrite == 0) {
+        rdpq_mode_zbuf(true, true);
+    }
+}
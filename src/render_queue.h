@@ -0,0 +1,28 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include "types.h"
+
+// =============================================================================
+// Render Queue
+// =============================================================================
+// Entities are enqueued during render_frame() and submitted per pass:
+//   opaque      - front-to-back, grouped by z-mode then combiner
+//   translucent - back-to-front (color alpha < 255), z-write off
+// Only state that differs from the previous item is emitted.
+
+typedef enum {
+    RENDER_PASS_OPAQUE,
+    RENDER_PASS_TRANSLUCENT,
+} RenderPass;
+
+#define RQ_CACHED    (1 << 0)   // Static geometry - replay the entity's pre-recorded block
+#define RQ_NO_ZWRITE (1 << 1)   // Opaque but must not write depth (e.g. station self Z-fighting)
+
+#define RENDER_QUEUE_SIZE 64
+
+void render_queue_begin(void);
+void render_queue_add(Entity *entity, uint8_t flags);
+void render_queue_submit(RenderPass pass);
+
+#endif // RENDER_QUEUE_H
@@ -0,0 +1,59 @@
+#include "spatial_grid.h"
+
+// =============================================================================
+// Cell Mapping
+// =============================================================================
+
+static int cell_coord(float v) {
+    int c = (int)((v + PLAY_AREA_RADIUS) * (1.0f / SPATIAL_GRID_CELL_SIZE));
+    if (c < 0) return 0;
+    if (c >= SPATIAL_GRID_DIM) return SPATIAL_GRID_DIM - 1;
+    return c;
+}
+
+// =============================================================================
+// Building
+// =============================================================================
+
+void spatial_grid_clear(SpatialGrid *grid) {
+    for (int i = 0; i < SPATIAL_GRID_CELL_COUNT; i++) {
+        grid->cell_head[i] = -1;
+    }
+    grid->max_radius = 0.0f;
+    grid->built = true;
+}
+
+void spatial_grid_insert(SpatialGrid *grid, int index, float x, float z, float radius) {
+    if (index < 0 || index >= SPATIAL_GRID_MAX_ITEMS) return;
+
+    int cell = cell_coord(z) * SPATIAL_GRID_DIM + cell_coord(x);
+    grid->next[index] = grid->cell_head[cell];
+    grid->cell_head[cell] = (int16_t)index;
+
+    if (radius > grid->max_radius) grid->max_radius = radius;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+// Indices of every item whose cell overlaps the square around (x, z)
+int spatial_grid_query(const SpatialGrid *grid, float x, float z, float radius, int *out_indices, int max_out) {
+    if (!grid->built) return 0;
+
+    int x0 = cell_coord(x - radius);
+    int x1 = cell_coord(x + radius);
+    int z0 = cell_coord(z - radius);
+    int z1 = cell_coord(z + radius);
+
+    int count = 0;
+    for (int cz = z0; cz <= z1; cz++) {
+        for (int cx = x0; cx <= x1; cx++) {
+            for (int i = grid->cell_head[cz * SPATIAL_GRID_DIM + cx]; i >= 0; i = grid->next[i]) {
+                if (count >= max_out) return count;
+                out_indices[count++] = i;
+            }
+        }
+    }
+    return count;
+}
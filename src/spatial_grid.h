@@ -0,0 +1,29 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "constants.h"
+
+// =============================================================================
+// Spatial Grid
+// =============================================================================
+// Uniform XZ grid over the arena. Each cell holds a linked list of item
+// indices. Positions outside the arena clamp into the border cells, so
+// queries stay correct for asteroids spawning past the edge.
+// Queries return candidates only - callers still do the exact distance test.
+
+#define SPATIAL_GRID_CELL_COUNT (SPATIAL_GRID_DIM * SPATIAL_GRID_DIM)
+
+typedef struct {
+    int16_t cell_head[SPATIAL_GRID_CELL_COUNT];   // -1 = empty
+    int16_t next[SPATIAL_GRID_MAX_ITEMS];
+    float max_radius;                             // Largest radius inserted (pad queries with this)
+    bool built;
+} SpatialGrid;
+
+void spatial_grid_clear(SpatialGrid *grid);
+void spatial_grid_insert(SpatialGrid *grid, int index, float x, float z, float radius);
+int spatial_grid_query(const SpatialGrid *grid, float x, float z, float radius, int *out_indices, int max_out);
+
+#endif // SPATIAL_GRID_H
@@ -2,7 +2,10 @@
 #include "constants.h"
 #include "utils.h"
 #include "entity.h"
+#include "entity_pool.h"
 #include "game_state.h"
+#include "culling.h"
+#include "draw_order.h"
 #include <rdpq.h>
 #include <math.h>
 #include <stdint.h>
@@ -64,6 +67,9 @@ void scale_resource_based_on_value(Entity *resource) {
 // =============================================================================
 
 void reset_entity(Entity *entity, EntityType type) {
+    // A respawn is a new object: handles to the old one go stale
+    entity_pool_invalidate(entity);
+
     if (type == ASTEROID) {
         get_asteroid_velocity_and_scale(entity, &entity->velocity);
     }
@@ -140,31 +146,6 @@ void move_entity(Entity *entity, float delta_time, EntityType type) {
     }
 }
 
-// =============================================================================
-// Asteroid Functions
-// =============================================================================
-
-void update_asteroids(Entity *asteroids, int count, float delta_time) {
-    for (int i = 0; i < count; i++) {
-        move_entity(&asteroids[i], delta_time, ASTEROID);
-    }
-}
-
-void init_asteroids(Entity *asteroids, int count) {
-    init_rotation_tables();
-
-    // Load asteroid model once and share it
-    if (shared_asteroid_model == NULL) {
-        shared_asteroid_model = t3d_model_load("rom:/asteroid8.t3dm");
-    }
-
-    for (int i = 0; i < count; i++) {
-        asteroids[i] = create_entity_shared(shared_asteroid_model, (T3DVec3){{0, 10, 0}},
-                                      randomize_float(0.1f, 1.3f), COLOR_FLAME, DRAW_SHADED, 10.0f);
-        reset_entity(&asteroids[i], ASTEROID);
-    }
-}
-
 // =============================================================================
 // Resource Functions
 // =============================================================================
@@ -184,8 +165,8 @@ void init_resources(Entity *resources, int count) {
     }
 
     for (int i = 0; i < count; i++) {
-        resources[i] = create_entity_shared(shared_asteroid_model, (T3DVec3){{0, 10, 0}},
-                                      1.0f, COLOR_RESOURCE, DRAW_SHADED, 20.0f);
+        init_entity_shared(&resources[i], shared_asteroid_model, (T3DVec3){{0, 10, 0}},
+                           1.0f, COLOR_RESOURCE, DRAW_SHADED, 20.0f);
         reset_entity(&resources[i], RESOURCE);
         resources[i].position.v[0] = randomize_float(-RESOURCE_BOUND_X, RESOURCE_BOUND_X);
         resources[i].position.v[2] = randomize_float(-RESOURCE_BOUND_Z, RESOURCE_BOUND_Z);
@@ -193,11 +174,15 @@ void init_resources(Entity *resources, int count) {
 }
 
 // =============================================================================
-// Optimized Asteroid System (matrix pool + tight struct)
+// Optimized Asteroid System (matrix pool + SoA store)
 // =============================================================================
 // Matrix pool - only allocate matrices for visible asteroids
+// (FB_COUNT pools back to back, one per frame in flight)
 static T3DMat4FP *asteroid_matrix_pool = NULL;
-static bool matrix_pool_used[ASTEROID_MATRIX_POOL_SIZE];
+
+// Asteroid mesh recorded once; each instance binds its matrix and replays it
+static rspq_block_t *asteroid_instance_block = NULL;
+static float asteroid_model_radius = 0.0f;
 
 void init_asteroid_system(void) {
     // Load shared model
@@ -207,183 +192,359 @@ void init_asteroid_system(void) {
 
     // Allocate matrix pool (uncached memory for RCP)
     if (asteroid_matrix_pool == NULL) {
-        asteroid_matrix_pool = malloc_uncached(sizeof(T3DMat4FP) * ASTEROID_MATRIX_POOL_SIZE);
+        asteroid_matrix_pool = malloc_uncached(sizeof(T3DMat4FP) * ASTEROID_MATRIX_POOL_SIZE * FB_COUNT);
+    }
+
+    if (asteroid_instance_block == NULL) {
+        rspq_block_begin();
+        t3d_matrix_push(t3d_segment_placeholder(ASTEROID_MATRIX_SEGMENT));
+        t3d_model_draw(shared_asteroid_model);
+        t3d_matrix_pop(1);
+        asteroid_instance_block = rspq_block_end();
+    }
+
+    asteroid_model_radius = get_model_bounding_radius(shared_asteroid_model);
+}
+
+float get_asteroid_model_radius(void) {
+    return asteroid_model_radius;
+}
+
+// =============================================================================
+// Asteroid Event Scheduler
+// =============================================================================
+// Asteroids fly in straight lines at constant speed from reset_asteroid(), so
+// when each one exits the boundary or reaches the static target circle (the
+// loader) is known at spawn. Those times go into min-heaps keyed on
+// asteroid_clock; per tick we only pop what has expired. A respawn bumps
+// event_gen, which turns any events still queued for the old path stale.
+// The clock is rebased every ASTEROID_CLOCK_REBASE seconds so float
+// precision doesn't erode over a long session.
+
+#define ASTEROID_CLOCK_REBASE 600.0f
+
+typedef struct {
+    float time;
+    int16_t index;
+    uint8_t gen;
+} AsteroidEvent;
+
+typedef struct {
+    AsteroidEvent items[ASTEROID_EVENT_CAPACITY];
+    int count;
+} AsteroidEventHeap;
+
+static AsteroidEventHeap exit_events;
+static AsteroidEventHeap target_events;
+static float asteroid_clock = 0.0f;
+
+static AsteroidStore *event_store = NULL;  // Store the event indices refer to
+
+static bool target_enabled = false;
+static float target_x, target_z, target_radius;
+
+static bool is_event_live(const AsteroidEvent *event) {
+    return event_store && event->index < event_store->count &&
+           event_store->event_gen[event->index] == event->gen;
+}
+
+static void heap_sift_up(AsteroidEventHeap *heap, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (heap->items[parent].time <= heap->items[i].time) break;
+        AsteroidEvent tmp = heap->items[parent];
+        heap->items[parent] = heap->items[i];
+        heap->items[i] = tmp;
+        i = parent;
+    }
+}
+
+static void heap_sift_down(AsteroidEventHeap *heap, int i) {
+    for (;;) {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+        if (left < heap->count && heap->items[left].time < heap->items[smallest].time) smallest = left;
+        if (right < heap->count && heap->items[right].time < heap->items[smallest].time) smallest = right;
+        if (smallest == i) break;
+        AsteroidEvent tmp = heap->items[smallest];
+        heap->items[smallest] = heap->items[i];
+        heap->items[i] = tmp;
+        i = smallest;
+    }
+}
+
+// Drop stale entries and re-heapify (only when full)
+static void heap_compact(AsteroidEventHeap *heap) {
+    int kept = 0;
+    for (int i = 0; i < heap->count; i++) {
+        if (is_event_live(&heap->items[i])) {
+            heap->items[kept++] = heap->items[i];
+        }
+    }
+    heap->count = kept;
+    for (int i = kept / 2 - 1; i >= 0; i--) {
+        heap_sift_down(heap, i);
+    }
+}
+
+static void heap_push(AsteroidEventHeap *heap, float time, int index, uint8_t gen) {
+    if (heap->count >= ASTEROID_EVENT_CAPACITY) {
+        heap_compact(heap);
+        if (heap->count >= ASTEROID_EVENT_CAPACITY) return;
+    }
+    heap->items[heap->count] = (AsteroidEvent){.time = time, .index = (int16_t)index, .gen = gen};
+    heap_sift_up(heap, heap->count);
+    heap->count++;
+}
+
+// Shifting every event by the same amount keeps the heap order
+static void heap_rebase(AsteroidEventHeap *heap, float offset) {
+    for (int i = 0; i < heap->count; i++) {
+        heap->items[i].time -= offset;
+    }
+}
+
+// Pops the next live event due by now; false if there is none
+static bool heap_pop_expired(AsteroidEventHeap *heap, int *out_index) {
+    while (heap->count > 0 && heap->items[0].time <= asteroid_clock) {
+        AsteroidEvent event = heap->items[0];
+        heap->items[0] = heap->items[--heap->count];
+        heap_sift_down(heap, 0);
+
+        if (is_event_live(&event)) {
+            *out_index = event.index;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Roots of |p + d*t| = radius along the asteroid's path (t in seconds)
+static bool solve_path_circle(const AsteroidStore *store, int i, float cx, float cz, float radius,
+                              float *t_enter, float *t_exit) {
+    float px = store->x[i] - cx;
+    float pz = store->z[i] - cz;
+    float dx = store->vx[i];
+    float dz = store->vz[i];
+
+    float qa = dx * dx + dz * dz;
+    if (qa < 0.0001f) return false;
+    float half_b = px * dx + pz * dz;
+    float c = px * px + pz * pz - radius * radius;
+    float disc = half_b * half_b - qa * c;
+    if (disc < 0.0f) return false;
+
+    float root = sqrtf(disc);
+    *t_enter = (-half_b - root) / qa;
+    *t_exit = (-half_b + root) / qa;
+    return true;
+}
+
+static void schedule_asteroid_events(AsteroidStore *store, int index) {
+    if (store != event_store) return;
+
+    uint8_t gen = ++store->event_gen[index];
+
+    float t_enter, t_exit;
+    float bound_radius = ASTEROID_BOUND_X + ASTEROID_PADDING;
+    // A path that never crosses the boundary is already out of it
+    if (!solve_path_circle(store, index, 0.0f, 0.0f, bound_radius, &t_enter, &t_exit)) {
+        t_exit = 0.0f;
+    }
+    if (t_exit < 0.0f) t_exit = 0.0f;
+    heap_push(&exit_events, asteroid_clock + t_exit, index, gen);
+
+    // Target hits get their own heap; the exit event above still covers
+    // asteroids nobody pops target hits for (title screen)
+    float t_hit, t_unused;
+    if (target_enabled &&
+        solve_path_circle(store, index, target_x, target_z, target_radius, &t_hit, &t_unused) &&
+        t_unused >= 0.0f && t_hit < t_exit) {
+        if (t_hit < 0.0f) t_hit = 0.0f;
+        heap_push(&target_events, asteroid_clock + t_hit, index, gen);
+    }
+}
+
+void set_asteroid_target_circle(T3DVec3 center, float radius) {
+    target_x = center.v[0];
+    target_z = center.v[2];
+    target_radius = radius;
+    target_enabled = true;
+}
+
+int pop_asteroid_target_hits(int *out_indices, int max_out) {
+    int count = 0;
+    while (count < max_out && heap_pop_expired(&target_events, &out_indices[count])) {
+        count++;
     }
+    return count;
+}
 
-    // Clear pool usage
-    for (int i = 0; i < ASTEROID_MATRIX_POOL_SIZE; i++) {
-        matrix_pool_used[i] = false;
+// For states where asteroids fly through the target (title screen), so old
+// hits don't fire later when the target becomes active
+void discard_asteroid_target_hits(void) {
+    int index;
+    while (heap_pop_expired(&target_events, &index)) {
     }
 }
 
-void reset_asteroid(Asteroid *asteroid) {
+void reset_asteroid(AsteroidStore *store, int i) {
     // Get difficulty-scaled speed
     float difficulty = get_asteroid_speed_for_difficulty();
     float min_speed = ASTEROID_BASE_MIN_SPEED * difficulty;
     float max_speed = ASTEROID_BASE_MAX_SPEED * difficulty;
 
-    asteroid->speed = randomize_float(min_speed, max_speed);
-    asteroid->scale = randomize_float(ASTEROID_MIN_SCALE, ASTEROID_MAX_SCALE);
-    asteroid->matrix_index = -1;  // No matrix assigned
+    float speed = randomize_float(min_speed, max_speed);
+    store->speed[i] = speed;
+    store->scale[i] = randomize_float(ASTEROID_MIN_SCALE, ASTEROID_MAX_SCALE);
 
     float bound_radius = ASTEROID_BOUND_X;
 
     // Spawn on circle edge at random angle
     float angle = randomize_float(0.0f, TWO_PI);
-    asteroid->position.v[0] = cosf(angle) * bound_radius;
-    asteroid->position.v[2] = sinf(angle) * bound_radius;
+    store->x[i] = cosf(angle) * bound_radius;
+    store->z[i] = sinf(angle) * bound_radius;
 
-    // Velocity points toward center with some randomness
+    // Velocity points toward center with some randomness (cos/sin is already unit length)
     float target_angle = angle + T3D_PI + randomize_float(-0.5f, 0.5f);
-    asteroid->velocity.v[0] = cosf(target_angle);
-    asteroid->velocity.v[2] = sinf(target_angle);
+    store->vx[i] = cosf(target_angle) * speed;
+    store->vz[i] = sinf(target_angle) * speed;
 
-    // Normalize velocity
-    float len_sq = asteroid->velocity.v[0] * asteroid->velocity.v[0] +
-                   asteroid->velocity.v[2] * asteroid->velocity.v[2];
-    if (len_sq > 0.0001f) {
-        float inv_len = fast_inv_sqrt(len_sq);
-        asteroid->velocity.v[0] *= inv_len;
-        asteroid->velocity.v[2] *= inv_len;
-    }
+    store->rotation_y[i] = randomize_float(0.0f, 360.0f);
+
+    schedule_asteroid_events(store, i);
+}
 
-    asteroid->position.v[1] = 10.0f;  // Fixed Y height
-    asteroid->velocity.v[1] = 0.0f;
-    asteroid->rotation_y = randomize_float(0.0f, 360.0f);
+// Moves an asteroid without changing its velocity; its queued events are
+// replaced with ones for the new path
+void place_asteroid(AsteroidStore *store, int i, float x, float z) {
+    store->x[i] = x;
+    store->z[i] = z;
+    schedule_asteroid_events(store, i);
 }
 
-void init_asteroids_optimized(Asteroid *asteroids, int count) {
+void init_asteroids_optimized(AsteroidStore *store, int count) {
     init_asteroid_system();
 
+    if (count > ASTEROID_STORE_CAPACITY) count = ASTEROID_STORE_CAPACITY;
+    store->count = count;
+
+    event_store = store;
+    exit_events.count = 0;
+    target_events.count = 0;
+    asteroid_clock = 0.0f;
+
     for (int i = 0; i < count; i++) {
-        reset_asteroid(&asteroids[i]);
+        reset_asteroid(store, i);
     }
 }
 
-void update_asteroids_optimized(Asteroid *asteroids, int count, float delta_time) {
-    float bound_radius = ASTEROID_BOUND_X + ASTEROID_PADDING;
-    float bound_radius_sq = bound_radius * bound_radius;
+void update_asteroids_optimized(AsteroidStore *store, float delta_time) {
+    asteroid_clock += delta_time;
+    if (asteroid_clock >= ASTEROID_CLOCK_REBASE) {
+        heap_rebase(&exit_events, asteroid_clock);
+        heap_rebase(&target_events, asteroid_clock);
+        asteroid_clock = 0.0f;
+    }
 
-    for (int i = 0; i < count; i++) {
-        Asteroid *a = &asteroids[i];
+    int count = store->count;
+    float *x = store->x;
+    float *z = store->z;
+    const float *vx = store->vx;
+    const float *vz = store->vz;
 
-        float move_amount = a->speed * delta_time;
-        a->position.v[0] += a->velocity.v[0] * move_amount;
-        a->position.v[2] += a->velocity.v[2] * move_amount;
+    for (int i = 0; i < count; i++) {
+        x[i] += vx[i] * delta_time;
+        z[i] += vz[i] * delta_time;
+    }
 
-        // Rotation only for nearby asteroids
-        float dx = a->position.v[0] - game.cursor_position.v[0];
-        float dz = a->position.v[2] - game.cursor_position.v[2];
-        float dist_sq = dx * dx + dz * dz;
+    // Rotation only for nearby asteroids
+    float *rotation_y = store->rotation_y;
+    const float *speed = store->speed;
+    float cursor_x = game.cursor_position.v[0];
+    float cursor_z = game.cursor_position.v[2];
 
-        if (dist_sq < ASTEROID_ROTATE_DISTANCE_SQ) {
-            a->rotation_y += move_amount * 0.03f;
-            if (a->rotation_y >= 360.0f) a->rotation_y -= 360.0f;
-            if (a->rotation_y < 0.0f) a->rotation_y += 360.0f;
-        }
-
-        // Boundary check (circular)
-        float pos_dist_sq = a->position.v[0] * a->position.v[0] +
-                            a->position.v[2] * a->position.v[2];
-        if (pos_dist_sq > bound_radius_sq) {
-            reset_asteroid(a);
-        }
+    for (int i = 0; i < count; i++) {
+        float dx = x[i] - cursor_x;
+        float dz = z[i] - cursor_z;
+        if (dx * dx + dz * dz >= ASTEROID_ROTATE_DISTANCE_SQ) continue;
+
+        float rotation = rotation_y[i] + speed[i] * delta_time * 0.03f;
+        if (rotation >= 360.0f) rotation -= 360.0f;
+        if (rotation < 0.0f) rotation += 360.0f;
+        rotation_y[i] = rotation;
     }
-}
 
-// Allocate a matrix from the pool, returns index or -1 if full
-static int8_t allocate_matrix(void) {
-    for (int i = 0; i < ASTEROID_MATRIX_POOL_SIZE; i++) {
-        if (!matrix_pool_used[i]) {
-            matrix_pool_used[i] = true;
-            return (int8_t)i;
-        }
+    // Respawn whatever has left the boundary (scheduled at spawn)
+    int index;
+    while (heap_pop_expired(&exit_events, &index)) {
+        reset_asteroid(event_store, index);
     }
-    return -1;  // Pool full
 }
 
-// Release all matrices back to pool (call each frame before drawing)
-static void release_all_matrices(void) {
-    for (int i = 0; i < ASTEROID_MATRIX_POOL_SIZE; i++) {
-        matrix_pool_used[i] = false;
-    }
+T3DVec3 get_asteroid_position(const AsteroidStore *store, int i) {
+    return (T3DVec3){{store->x[i], ASTEROID_HEIGHT, store->z[i]}};
 }
 
-void draw_asteroids_optimized(Asteroid *asteroids, bool *visibility, float *distance_sq, int count) {
-    // Release all matrices from last frame
-    release_all_matrices();
+// Depth order carried between frames (see draw_order.h)
+static DrawOrder asteroid_draw_order;
+static uint32_t asteroid_sort_keys[ASTEROID_STORE_CAPACITY];
 
-    // Build sorted list of visible asteroid indices (closest first)
-    static struct { int index; float dist; } sorted[ASTEROID_MATRIX_POOL_SIZE];
-    int visible_count = 0;
+// alpha interpolates between the last two sim ticks. Asteroids fly in straight
+// lines, so the previous tick is recovered from velocity instead of stored.
+void draw_asteroids_optimized(const AsteroidStore *store, bool *visibility, float *distance_sq, float alpha) {
+    int count = store->count;
 
+    // Hidden asteroids sort to the back, so the visible ones come out closest first
+    int visible_count = 0;
     for (int i = 0; i < count; i++) {
-        if (!visibility[i]) continue;
-
-        // Insert into sorted list (simple insertion sort, limited to pool size)
-        if (visible_count < ASTEROID_MATRIX_POOL_SIZE) {
-            // Find insertion point
-            int insert_at = visible_count;
-            for (int j = 0; j < visible_count; j++) {
-                if (distance_sq[i] < sorted[j].dist) {
-                    insert_at = j;
-                    break;
-                }
-            }
-            // Shift elements
-            for (int j = visible_count; j > insert_at; j--) {
-                sorted[j] = sorted[j-1];
-            }
-            sorted[insert_at].index = i;
-            sorted[insert_at].dist = distance_sq[i];
+        if (visibility[i]) {
+            asteroid_sort_keys[i] = depth_sort_key(distance_sq[i]);
             visible_count++;
-        } else if (distance_sq[i] < sorted[ASTEROID_MATRIX_POOL_SIZE-1].dist) {
-            // Closer than furthest in list - replace it
-            int insert_at = ASTEROID_MATRIX_POOL_SIZE - 1;
-            for (int j = 0; j < ASTEROID_MATRIX_POOL_SIZE - 1; j++) {
-                if (distance_sq[i] < sorted[j].dist) {
-                    insert_at = j;
-                    break;
-                }
-            }
-            // Shift elements (drop the last one)
-            for (int j = ASTEROID_MATRIX_POOL_SIZE - 1; j > insert_at; j--) {
-                sorted[j] = sorted[j-1];
-            }
-            sorted[insert_at].index = i;
-            sorted[insert_at].dist = distance_sq[i];
+        } else {
+            asteroid_sort_keys[i] = UINT32_MAX;
         }
     }
+    draw_order_sort(&asteroid_draw_order, asteroid_sort_keys, count);
+
+    // Closest ones get the matrix pool
+    if (visible_count > ASTEROID_MATRIX_POOL_SIZE) {
+        visible_count = ASTEROID_MATRIX_POOL_SIZE;
+    }
+
+    // Pool for this frame's slot
+    T3DMat4FP *frame_pool = &asteroid_matrix_pool[game.frame_idx * ASTEROID_MATRIX_POOL_SIZE];
 
     // Set up shared rendering state
     rdpq_set_prim_color(COLOR_FLAME);
     rdpq_mode_combiner(RDPQ_COMBINER1((PRIM, 0, SHADE, 0), (PRIM, 0, SHADE, 0)));
 
-    // Draw sorted asteroids (closest first)
+    // Draw sorted asteroids (closest first) - one matrix bind + block replay each
+    float back = FIXED_TIMESTEP * (1.0f - alpha);
     for (int s = 0; s < visible_count; s++) {
-        int i = sorted[s].index;
-        Asteroid *a = &asteroids[i];
-
-        // Allocate matrix from pool
-        int8_t mat_idx = allocate_matrix();
-        if (mat_idx < 0) break;  // Pool exhausted
-
-        a->matrix_index = mat_idx;
-        T3DMat4FP *matrix = &asteroid_matrix_pool[mat_idx];
+        int i = asteroid_draw_order.order[s];
+        T3DMat4FP *matrix = &frame_pool[s];
 
+        float scale = store->scale[i];
         t3d_mat4fp_from_srt_euler(matrix,
-            (float[3]){a->scale, a->scale, a->scale},
-            (float[3]){a->rotation_y, 0.0f, 0.0f},
-            a->position.v);
-
-        // Draw
-        t3d_matrix_push(matrix);
-        t3d_model_draw(shared_asteroid_model);
-        t3d_matrix_pop(1);
+            (float[3]){scale, scale, scale},
+            (float[3]){store->rotation_y[i], 0.0f, 0.0f},
+            (float[3]){store->x[i] - store->vx[i] * back,
+                       ASTEROID_HEIGHT,
+                       store->z[i] - store->vz[i] * back});
+
+        t3d_segment_set(ASTEROID_MATRIX_SEGMENT, matrix);
+        rspq_block_run(asteroid_instance_block);
     }
 }
 
 void free_asteroid_system(void) {
+    if (asteroid_instance_block != NULL) {
+        rspq_wait();
+        rspq_block_free(asteroid_instance_block);
+        asteroid_instance_block = NULL;
+    }
     if (asteroid_matrix_pool != NULL) {
         free_uncached(asteroid_matrix_pool);
         asteroid_matrix_pool = NULL;
@@ -11,22 +11,26 @@ void reset_entity(Entity *entity, EntityType type);
 void move_entity(Entity *entity, float delta_time, EntityType type);
 
 // =============================================================================
-// Optimized Asteroid Functions (uses Asteroid struct + matrix pool)
+// Optimized Asteroid Functions (uses AsteroidStore + matrix pool)
 // =============================================================================
 
 void init_asteroid_system(void);
-void init_asteroids_optimized(Asteroid *asteroids, int count);
-void update_asteroids_optimized(Asteroid *asteroids, int count, float delta_time);
-void reset_asteroid(Asteroid *asteroid);
-void draw_asteroids_optimized(Asteroid *asteroids, bool *visibility, float *distance_sq, int count);
+void init_asteroids_optimized(AsteroidStore *store, int count);
+void update_asteroids_optimized(AsteroidStore *store, float delta_time);
+void reset_asteroid(AsteroidStore *store, int index);
+void place_asteroid(AsteroidStore *store, int index, float x, float z);
+void draw_asteroids_optimized(const AsteroidStore *store, bool *visibility, float *distance_sq, float alpha);
+T3DVec3 get_asteroid_position(const AsteroidStore *store, int index);
 void free_asteroid_system(void);
 
-// =============================================================================
-// Legacy Asteroid Functions (for Entity-based asteroids)
-// =============================================================================
+// Bounding radius of the shared asteroid model at scale 1 (for culling)
+float get_asteroid_model_radius(void);
 
-void init_asteroids(Entity *asteroids, int count);
-void update_asteroids(Entity *asteroids, int count, float delta_time);
+// Event scheduler: the static circle asteroids are tested against (the loader),
+// and the asteroids whose scheduled hit on it has come due
+void set_asteroid_target_circle(T3DVec3 center, float radius);
+int pop_asteroid_target_hits(int *out_indices, int max_out);
+void discard_asteroid_target_hits(void);
 
 // =============================================================================
 // Resource Functions
@@ -20,19 +20,45 @@ typedef enum {
 // Entity Structure
 // =============================================================================
 
+// Hot simulation state only - what movement and collision loops read. The
+// render side lives in EntityRender, a parallel array in the entity pool
+// (see entity_render()).
 typedef struct {
-    T3DModel *model;
-    T3DMat4FP *matrix;
+    // Transform
     T3DVec3 position;
-    T3DVec3 velocity;
-    color_t color;
-    float scale;
     T3DVec3 rotation;
+    float scale;
+    // Motion
+    T3DVec3 velocity;
     float speed;
+    // Collider / gameplay
     float collision_radius;
     int value;
+    color_t color;
+} Entity;                     // 56 bytes
+
+// Cold render state, one per entity pool slot
+typedef struct {
+    T3DModel *model;
+    T3DMat4FP *matrix;        // FB_COUNT slots, indexed by game.frame_idx (owned by the pool)
+    rspq_block_t *block;      // Pre-recorded geometry (static entities only), NULL until first use
     DrawType draw_type;
-} Entity;
+    T3DVec3 prev_position;    // Previous sim tick (render interpolation)
+    T3DVec3 prev_rotation;
+    // Static transform the matrix slots in built_slots hold (see build_entity_matrix)
+    T3DVec3 built_position;
+    T3DVec3 built_rotation;
+    T3DVec3 built_scale;
+    uint8_t built_slots;      // Bit per frame_idx
+} EntityRender;
+
+// Pool slot plus the generation it was issued for (see entity_pool.h)
+typedef struct {
+    uint16_t index;
+    uint16_t generation;
+} EntityHandle;
+
+#define ENTITY_HANDLE_NONE ((EntityHandle){ 0xFFFF, 0 })
 
 // =============================================================================
 // Entity IDs
@@ -91,19 +117,26 @@ typedef enum {
 // } AsteroidID;
 
 // =============================================================================
-// Optimized Asteroid Structure (32 bytes - fits in 2 cache lines)
+// Asteroid Store (structure of arrays)
 // Shared data (model, color, collision_radius) stored separately
 // =============================================================================
+// Each loop streams only the arrays it reads (movement: x/z/vx/vz, grid and
+// culling: x/z/scale, ...) instead of pulling whole records through the
+// D-cache. All asteroids fly at ASTEROID_HEIGHT.
+
+#define ASTEROID_STORE_CAPACITY 128
 
 typedef struct {
-    T3DVec3 position;         // 12 bytes
-    T3DVec3 velocity;         // 12 bytes
-    float scale;              // 4 bytes
-    float rotation_y;         // 4 bytes (only need Y rotation)
-    float speed;              // 4 bytes
-    int8_t matrix_index;      // 1 byte (-1 = no matrix assigned)
-    uint8_t padding[3];       // 3 bytes padding for alignment
-} Asteroid;                   // Total: 40 bytes
+    float x[ASTEROID_STORE_CAPACITY];
+    float z[ASTEROID_STORE_CAPACITY];
+    float vx[ASTEROID_STORE_CAPACITY];          // Direction * speed (units/second)
+    float vz[ASTEROID_STORE_CAPACITY];
+    float rotation_y[ASTEROID_STORE_CAPACITY];
+    float scale[ASTEROID_STORE_CAPACITY];
+    float speed[ASTEROID_STORE_CAPACITY];       // |velocity| - damage, culling pad
+    uint8_t event_gen[ASTEROID_STORE_CAPACITY]; // Bumped on respawn to invalidate scheduled events
+    int count;
+} AsteroidStore;
 
 // Maximum visible asteroids at once (matrix pool size)
 #define ASTEROID_MATRIX_POOL_SIZE 48
@@ -148,7 +181,7 @@ typedef enum {
 // =============================================================================
 
 typedef struct {
-    Entity *entity;
+    EntityHandle entity;
     color_t original_color;
     color_t flash_color;
     float timer;
@@ -170,15 +203,18 @@ typedef struct {
 // Particle Data (used by particle system)
 // =============================================================================
 
+// Compact fixed-point record; live particles are packed at the front of the
+// pool, so there is no active flag
 typedef struct {
-    T3DVec3 position;
-    T3DVec3 velocity;
+    int16_t position[3];      // World units, 12.4 fixed point
+    int16_t velocity[3];      // Units/second, 10.6 fixed point
     color_t color;
-    float size;
-    float lifetime;
-    float max_lifetime;
-    bool active;
-} ParticleData;
+    uint16_t lifetime_ms;     // Remaining
+    uint16_t fade_rate;       // (255 << 12) / max lifetime, so alpha = lifetime_ms * fade_rate >> 12
+    uint8_t size;             // 1/4096 units
+    uint8_t emitter;          // ParticleEmitter that spawned it
+    uint8_t padding[2];
+} ParticleData;               // 24 bytes
 
 
 
@@ -3,6 +3,8 @@
 #include "game_state.h"
 #include <rdpq.h>
 #include <malloc.h>
+#include <stdarg.h>
+#include <stdio.h>
 
 
 // =============================================================================
@@ -17,6 +19,42 @@ int get_tutorial_page(void) { return tutorial_page; }
 void set_tutorial_selection(int val) { tutorial_selection = val; }
 void set_tutorial_page(int val) { tutorial_page = val; }
 
+// =============================================================================
+// Cached Text
+// =============================================================================
+
+bool cached_text_update(CachedText *text, int key, const rdpq_textparms_t *parms,
+                        uint8_t font_id, const char *fmt, ...) {
+    if (text->layout && text->key == key) return false;
+
+    char buffer[64];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    if (len >= (int)sizeof(buffer)) len = sizeof(buffer) - 1;
+
+    if (text->layout) {
+        rdpq_paragraph_free(text->layout);
+    }
+    text->layout = rdpq_paragraph_build(parms, font_id, buffer, &len);
+    text->key = key;
+    return true;
+}
+
+void cached_text_draw(const CachedText *text, float x, float y) {
+    if (text->layout) {
+        rdpq_paragraph_render(text->layout, x, y);
+    }
+}
+
+void cached_text_free(CachedText *text) {
+    if (text->layout) {
+        rdpq_paragraph_free(text->layout);
+        text->layout = NULL;
+    }
+}
+
 // =============================================================================
 // FPS Stats
 // =============================================================================
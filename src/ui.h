@@ -19,6 +19,21 @@ void draw_triangle_indicator(int x, int y);
 void draw_circle_indicator(int x, int y);
 void draw_station_indicator(int x, int y);
 
+// =============================================================================
+// Cached Text (layout rebuilt only when its key changes)
+// =============================================================================
+
+typedef struct {
+    rdpq_paragraph_t *layout;
+    int key;                  // Input value the layout was built from
+} CachedText;
+
+// Returns true if the layout was rebuilt
+bool cached_text_update(CachedText *text, int key, const rdpq_textparms_t *parms,
+                        uint8_t font_id, const char *fmt, ...);
+void cached_text_draw(const CachedText *text, float x, float y);
+void cached_text_free(CachedText *text);
+
 // =============================================================================
 // FPS Display
 // =============================================================================